@@ -44,6 +44,8 @@ macro(set_developer_defaults)
 
 	option(ENABLE_DOCUMENTATION "Build documentation with Doxygen and Sphinx" ON)
 
+	option(ECOLE_BUILD_TOOLS "Build Ecole command line tools" ON)
+
 endmacro()
 
 
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <random>
 #include <string>
 #include <tuple>
 
 #include "ecole/environment/dynamics.hpp"
 #include "ecole/reward/abstract.hpp"
+#include "ecole/scip/type.hpp"
 
 namespace ecole {
 
@@ -18,7 +21,49 @@ namespace environment {
 using Seed = typename RandomEngine::result_type;
 
 using ecole::reward::Reward;
-using Info = int;  // FIXME dummy type while the information is not implemented
+/**
+ * Why an episode ended.
+ */
+enum class DoneReason {
+	/** The episode is not over. */
+	NotDone,
+	/** The solving process finished (solved, infeasible, or a SCIP limit was reached). */
+	Finished,
+	/** The solving was stopped because it exceeded the memory budget. */
+	MemoryLimit,
+};
+
+/**
+ * Wall time spent in the phases of a transition.
+ */
+struct StepTimings {
+	/** Time in the dynamics, that is solving until the next decision. */
+	std::chrono::nanoseconds dynamics{0};
+	/** Part of the dynamics time where the solver thread was running. */
+	std::chrono::nanoseconds solver{0};
+	/** Part of the dynamics time spent handing the model between the environment and solver. */
+	std::chrono::nanoseconds handoff{0};
+	/** Time extracting the observation. */
+	std::chrono::nanoseconds observation{0};
+	/** Time computing the reward. */
+	std::chrono::nanoseconds reward{0};
+};
+
+/**
+ * Additional information about a transition.
+ */
+struct Info {
+	DoneReason done_reason = DoneReason::NotDone;
+	/** Memory used by the solver after the transition. */
+	scip::MemoryStats memory;
+	/** Memory held by the observation returned with the transition, in bytes. */
+	std::size_t observation_memory = 0;
+	StepTimings timings;
+	/** Branch-and-bound nodes processed during the transition. */
+	scip::long_int n_nodes = 0;
+	/** LP iterations done during the transition. */
+	scip::long_int n_lp_iterations = 0;
+};
 
 /**
  * Abstract base class for all environments.
@@ -1,15 +1,25 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <map>
+#include <memory>
 #include <random>
+#include <string>
 #include <tuple>
 #include <type_traits>
 
 #include "ecole/abstract.hpp"
+#include "ecole/environment/episode-model.hpp"
 #include "ecole/environment/exception.hpp"
+#include "ecole/environment/memory.hpp"
+#include "ecole/instance/prefetcher.hpp"
+#include "ecole/observation/abstract.hpp"
 #include "ecole/scip/model.hpp"
 #include "ecole/scip/type.hpp"
 #include "ecole/traits.hpp"
+#include "ecole/utility/chrono.hpp"
 
 namespace ecole {
 namespace environment {
@@ -37,8 +47,9 @@ public:
 		m_dynamics(std::forward<Args>(args)...),
 		m_obs_func(std::move(obs_func)),
 		m_reward_func(std::move(reward_func)),
-		m_scip_params(std::move(scip_params)),
-		random_engine(std::random_device{}()) {}
+		random_engine(std::random_device{}()) {
+		episode.scip_params() = std::move(scip_params);
+	}
 
 	/**
 	 * @copydoc ecole::environment::Environment::seed
@@ -49,41 +60,41 @@ public:
 	 * @copydoc ecole::environment::Environment::reset
 	 */
 	std::tuple<Observation, ActionSet, Reward, bool> reset(scip::Model&& new_model) override {
-		can_transition = true;
-		try {
-			// Create clean new Model
-			model() = std::move(new_model);
-			model().set_params(scip_params());
-			dynamics().set_dynamics_random_state(model(), random_engine);
-
-			// Bring model to initial state and reset state functions
-			bool done;
-			ActionSet action_set;
-			std::tie(done, action_set) = dynamics().reset_dynamics(model());
-			obs_func().reset(model());
-			reward_func().reset(model());
-
-			can_transition = !done;
-			auto const reward_offset = reward_func().obtain_reward(model(), done);
-			return {obs_func().obtain_observation(model()), std::move(action_set), reward_offset, done};
-		} catch (std::exception const&) {
-			can_transition = false;
-			throw;
-		}
+		can_transition = false;
+		episode.reset(std::move(new_model));
+		return reset_model();
 	}
 
 	/**
 	 * @copydoc ecole::environment::Environment::reset
+	 *
+	 * When reusing the model, the file is not read again if it is the one of the current episode.
 	 */
 	std::tuple<Observation, ActionSet, Reward, bool> reset(std::string const& filename) override {
-		return reset(scip::Model::from_file(filename));
+		can_transition = false;
+		episode.reset(filename);
+		return reset_model();
 	}
 
 	/**
 	 * @copydoc ecole::environment::Environment::reset
+	 *
+	 * When reusing the model, the model is not copied if it has the same fingerprint as the
+	 * instance of the current episode.
 	 */
 	std::tuple<Observation, ActionSet, Reward, bool> reset(scip::Model const& model) override {
-		return reset(model.copy_orig());
+		can_transition = false;
+		episode.reset(model);
+		return reset_model();
+	}
+
+	/**
+	 * Reset on the next instance of a prefetcher, which is neither read nor copied.
+	 */
+	std::tuple<Observation, ActionSet, Reward, bool> reset(instance::InstancePrefetcher& prefetcher) {
+		can_transition = false;
+		episode.reset(prefetcher);
+		return reset_model();
 	}
 
 	/**
@@ -92,18 +103,39 @@ public:
 	std::tuple<Observation, ActionSet, Reward, bool, Info> step(Action const& action) override {
 		if (!can_transition) throw Exception("Environment need to be reset.");
 		try {
+			using utility::time_call;
+			auto info = Info{};
+			auto& timings = info.timings;
+			auto const solver_start = model().solver_time();
+
 			bool done;
 			ActionSet action_set;
-			std::tie(done, action_set) = dynamics().step_dynamics(model(), action);
+			std::tie(done, action_set) = time_call(timings.dynamics, [&] {
+				auto result = dynamics().step_dynamics(model(), action);
+				std::get<0>(result) = enforce_memory_budget(std::get<0>(result), std::get<1>(result));
+				return result;
+			});
+			timings.solver = model().solver_time().wall - solver_start.wall;
+			timings.handoff = std::max(timings.dynamics - timings.solver, std::chrono::nanoseconds{0});
 			can_transition = !done;
-			auto const reward = reward_func().obtain_reward(model(), done);
-
+			auto const reward =
+				time_call(timings.reward, [&] { return reward_func().obtain_reward(model(), done); });
+			auto observation =
+				time_call(timings.observation, [&] { return obs_func().obtain_observation(model()); });
+
+			auto const stats = model().stats();
+			info.done_reason = done_reason(model(), done, memory_exceeded);
+			info.memory = stats.memory;
+			info.observation_memory = observation::buffer_size(observation);
+			info.n_nodes = stats.n_nodes - last_stats.n_nodes;
+			info.n_lp_iterations = stats.n_lp_iterations - last_stats.n_lp_iterations;
+			last_stats = stats;
 			return {
-				obs_func().obtain_observation(model()),
+				std::move(observation),
 				std::move(action_set),
 				reward,
 				done,
-				Info{},
+				std::move(info),
 			};
 		} catch (std::exception const&) {
 			can_transition = false;
@@ -112,19 +144,77 @@ public:
 	}
 
 	auto& dynamics() { return m_dynamics; }
-	auto& model() { return m_model; }
+	auto& model() { return episode.model(); }
 	auto& obs_func() { return m_obs_func; }
 	auto& reward_func() { return m_reward_func; }
-	auto& scip_params() { return m_scip_params; }
+	auto& scip_params() { return episode.scip_params(); }
+	/**
+	 * @copydoc ecole::environment::EpisodeModel::memory_budget
+	 *
+	 * When the budget is exceeded, the episode terminates with DoneReason::MemoryLimit.
+	 */
+	auto& memory_budget() { return episode.memory_budget(); }
+	/** @copydoc ecole::environment::EpisodeModel::root_basis_cache */
+	auto& root_basis_cache() { return episode.root_basis_cache(); }
+	/** @copydoc ecole::environment::EpisodeModel::reuse_model */
+	auto& reuse_model() { return episode.reuse_model(); }
+	/** @copydoc ecole::environment::EpisodeModel::presolve_cache */
+	auto& presolve_cache() { return episode.presolve_cache(); }
+	/** @copydoc ecole::environment::EpisodeModel::presolved_problem */
+	auto const& presolved_problem() const noexcept { return episode.presolved_problem(); }
 
 private:
 	Dynamics m_dynamics;
-	scip::Model m_model;
+	EpisodeModel episode;
 	ObservationFunction m_obs_func;
 	RewardFunction m_reward_func;
-	std::map<std::string, scip::Param> m_scip_params;
 	RandomEngine random_engine;
 	bool can_transition = false;
+	bool memory_exceeded = false;
+	/** Statistics at the end of the last transition, to count the work done in the next. */
+	scip::SolverStats last_stats;
+
+	/**
+	 * Start a new episode on the model prepared by the EpisodeModel.
+	 */
+	std::tuple<Observation, ActionSet, Reward, bool> reset_model() {
+		can_transition = true;
+		memory_exceeded = false;
+		try {
+			dynamics().set_dynamics_random_state(model(), random_engine);
+			reward_func().before_reset(model());
+
+			// Bring model to initial state and reset state functions
+			bool done;
+			ActionSet action_set;
+			std::tie(done, action_set) = dynamics().reset_dynamics(model());
+			done = enforce_memory_budget(done, action_set);
+			obs_func().reset(model());
+			reward_func().reset(model());
+
+			can_transition = !done;
+			auto const reward_offset = reward_func().obtain_reward(model(), done);
+			last_stats = model().stats();
+			return {obs_func().obtain_observation(model()), std::move(action_set), reward_offset, done};
+		} catch (std::exception const&) {
+			can_transition = false;
+			throw;
+		}
+	}
+
+	/**
+	 * Stop the solving, through the Controller, if the Model exceeds its memory budget.
+	 *
+	 * @return Whether the episode is over.
+	 */
+	bool enforce_memory_budget(bool done, ActionSet& action_set) {
+		if (done || (memory_budget() == 0)) return done;
+		if (!exceeds_memory_budget(model(), memory_budget())) return false;
+		model().solve_iter_stop();
+		memory_exceeded = true;
+		action_set = ActionSet{};
+		return true;
+	}
 };
 
 }  // namespace environment
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ecole/instance/prefetcher.hpp"
+#include "ecole/scip/basis-cache.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/presolve-cache.hpp"
+#include "ecole/scip/type.hpp"
+
+namespace ecole {
+namespace environment {
+
+/**
+ * The model of the episodes of an environment, and the options used to start them.
+ *
+ * Choose the model of a new episode and prepare it with the SCIP parameters, presolve cache,
+ * memory budget, and root basis cache.
+ * Shared by the EnvironmentComposer and the Python environments with Python dynamics or
+ * observation functions, so that all environments start their episodes the same way.
+ */
+class EpisodeModel {
+public:
+	/**
+	 * Start an episode on the model, which is used as is.
+	 */
+	void reset(scip::Model&& new_model);
+	/**
+	 * Start an episode on a copy of the model.
+	 *
+	 * When reusing the model, the model is not copied if it has the same fingerprint as the
+	 * instance of the current episode.
+	 */
+	void reset(scip::Model const& model);
+	/**
+	 * Start an episode on the problem read from a file.
+	 *
+	 * When reusing the model, the file is not read again if it is the one of the current episode.
+	 */
+	void reset(std::string const& filename);
+	/**
+	 * Start an episode on the next instance of a prefetcher, which is neither read nor copied.
+	 */
+	void reset(instance::InstancePrefetcher& prefetcher);
+
+	scip::Model& model() noexcept { return m_model; }
+	scip::Model const& model() const noexcept { return m_model; }
+	auto& scip_params() noexcept { return m_scip_params; }
+	/**
+	 * Maximum memory in bytes used by the solver in an episode, or zero for no budget.
+	 */
+	auto& memory_budget() noexcept { return m_memory_budget; }
+	/**
+	 * Cache of root LP bases used to warm start episodes on previously seen instances, or null.
+	 *
+	 * The LP iterations saved are not done, and therefore not counted by the LpIterations reward,
+	 * which reports them separately.
+	 */
+	auto& root_basis_cache() noexcept { return m_root_basis_cache; }
+	/**
+	 * Whether to reuse the current model when reset on the same instance.
+	 *
+	 * Instead of reading or copying the instance in a new SCIP object, the transformed problem
+	 * is freed and the solving restarts on the same SCIP object, with new random seeds.
+	 * The instance is the same if given by the same file name, or by a model with the same
+	 * fingerprint.
+	 */
+	auto& reuse_model() noexcept { return m_reuse_model; }
+	/**
+	 * Cache of presolved problems from which to start episodes, or null to presolve every episode.
+	 *
+	 * With a cache, episodes solve the presolved problem with presolving disabled, and random
+	 * seeds no longer affect presolving.
+	 * Instances for which presolving ends the solve are solved from their original problem.
+	 */
+	auto& presolve_cache() noexcept { return m_presolve_cache; }
+	/**
+	 * The presolved problem solved in the current episode, with the mapping to the original
+	 * variables, or null if not using a presolve cache or if presolving ends the solve.
+	 */
+	auto const& presolved_problem() const noexcept { return m_presolved_problem; }
+
+private:
+	scip::Model m_model;
+	std::map<std::string, scip::Param> m_scip_params;
+	std::size_t m_memory_budget = 0;
+	std::shared_ptr<scip::RootBasisCache> m_root_basis_cache;
+	bool m_reuse_model = false;
+	std::shared_ptr<scip::PresolveCache> m_presolve_cache;
+	std::shared_ptr<scip::PresolvedProblem const> m_presolved_problem;
+	/** Identification of the instance of the current model, when reusing it. */
+	bool has_instance = false;
+	std::string instance_filename;
+	std::uint64_t instance_fingerprint = 0;
+	/** Parameters of the instance before the episode, restored when reusing the model. */
+	std::map<std::string, scip::Param> instance_params;
+
+	/**
+	 * Restart the solving of the current model, with its parameters from before the episode.
+	 */
+	void reset_same_instance();
+	/**
+	 * Replace the model by a copy of its presolved problem, when using a presolve cache.
+	 *
+	 * A model reused on the same instance is already a copy of the presolved problem.
+	 */
+	void use_presolved_problem();
+	/**
+	 * Apply the options to the current model, which must be in its original problem stage.
+	 */
+	void prepare_model();
+};
+
+}  // namespace environment
+}  // namespace ecole
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+
+#include "ecole/environment/abstract.hpp"
+
+namespace ecole {
+
+namespace scip {
+class Model;
+}
+
+namespace environment {
+
+/**
+ * Lower the SCIP memory limit so that the solver stops by itself within the budget (in bytes).
+ */
+void set_memory_limit(scip::Model& model, std::size_t budget);
+
+/**
+ * Whether the memory used by the model (including external estimate) exceeds the budget.
+ */
+bool exceeds_memory_budget(scip::Model const& model, std::size_t budget);
+
+/**
+ * Find why an episode ended, given whether the environment stopped it for exceeding its budget.
+ */
+DoneReason done_reason(scip::Model const& model, bool done, bool memory_exceeded);
+
+}  // namespace environment
+}  // namespace ecole
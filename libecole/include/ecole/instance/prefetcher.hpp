@@ -0,0 +1,93 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <nonstd/optional.hpp>
+
+#include "ecole/instance/source.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole {
+namespace instance {
+
+/**
+ * Statistics of an InstancePrefetcher.
+ */
+struct PrefetchStats {
+	/** Number of instances taken from the prefetcher. */
+	std::size_t n_instances = 0;
+	/** Number of instances that were not ready when requested. */
+	std::size_t n_stalls = 0;
+	/** Time spent waiting for instances that were not ready. */
+	std::chrono::nanoseconds stall_time{0};
+	/** Time spent by the background thread reading or generating instances. */
+	std::chrono::nanoseconds load_time{0};
+	/** Number of instances ready to be taken. */
+	std::size_t n_ready = 0;
+	/** Solver memory held by the instances ready to be taken, in bytes. */
+	std::size_t ready_memory = 0;
+};
+
+/**
+ * Read or generate instances ahead of time in a background thread.
+ *
+ * Up to `n_ahead` instances are kept ready to be taken, as Models on which environments can be
+ * reset without parsing nor copying the instance.
+ * With a non zero memory budget, no further instance is loaded while the ready instances use
+ * more solver memory than the budget (but at least one instance is always loaded).
+ * Errors raised while loading an instance are rethrown when it is taken.
+ */
+class InstancePrefetcher {
+public:
+	InstancePrefetcher(
+		std::shared_ptr<InstanceSource> source,
+		std::size_t n_ahead = 2,
+		std::size_t memory_budget = 0);
+	InstancePrefetcher(InstancePrefetcher const&) = delete;
+	InstancePrefetcher& operator=(InstancePrefetcher const&) = delete;
+	~InstancePrefetcher();
+
+	/**
+	 * Take the next instance, waiting for it if not ready, or none if the source is exhausted.
+	 */
+	nonstd::optional<scip::Model> next();
+
+	/**
+	 * Stop the background thread, dropping the instances not yet taken.
+	 */
+	void close();
+
+	PrefetchStats stats() const;
+
+private:
+	/** An instance loaded by the background thread, or the error raised while loading it. */
+	struct Entry {
+		nonstd::optional<scip::Model> model;
+		std::exception_ptr error;
+		std::size_t memory = 0;
+	};
+
+	std::shared_ptr<InstanceSource> source;
+	std::size_t n_ahead;
+	std::size_t memory_budget;
+	mutable std::mutex mutex;
+	std::condition_variable ready_changed;
+	std::deque<Entry> ready;
+	bool exhausted = false;
+	bool closed = false;
+	PrefetchStats m_stats;
+	std::thread thread;
+
+	bool has_room() const noexcept;
+	void load_instances();
+};
+
+}  // namespace instance
+}  // namespace ecole
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <nonstd/optional.hpp>
+
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/plugins.hpp"
+
+namespace ecole {
+namespace instance {
+
+/**
+ * A sequence of problem instances, read or generated on demand.
+ *
+ * Sources are not thread safe, they are meant to be consumed by a single thread, for instance
+ * the one of an InstancePrefetcher.
+ */
+class InstanceSource {
+public:
+	virtual ~InstanceSource() = default;
+
+	/**
+	 * The next instance, or none if the source is exhausted.
+	 */
+	virtual nonstd::optional<scip::Model> next() = 0;
+};
+
+/**
+ * Instances read from a list of files.
+ */
+class FileSource : public InstanceSource {
+public:
+	/**
+	 * Read the files in order, cycling back to the first one at the end if requested.
+	 */
+	FileSource(
+		std::vector<std::string> filenames,
+		bool cycle = false,
+		scip::PluginProfile profile = scip::PluginProfile::Full);
+
+	/**
+	 * Files matching a shell pattern (`*`, `?`, `[...]`), in alphabetical order.
+	 */
+	static FileSource from_glob(
+		std::string const& pattern,
+		bool cycle = false,
+		scip::PluginProfile profile = scip::PluginProfile::Full);
+
+	nonstd::optional<scip::Model> next() override;
+
+	std::vector<std::string> const& filenames() const noexcept { return m_filenames; }
+
+private:
+	std::vector<std::string> m_filenames;
+	bool cycle;
+	scip::PluginProfile profile;
+	std::size_t index = 0;
+};
+
+/**
+ * Instances made by a function, until it returns none.
+ */
+class GeneratorSource : public InstanceSource {
+public:
+	using Generator = std::function<nonstd::optional<scip::Model>()>;
+
+	explicit GeneratorSource(Generator generator) noexcept;
+
+	nonstd::optional<scip::Model> next() override;
+
+private:
+	Generator generator;
+};
+
+}  // namespace instance
+}  // namespace ecole
@@ -1,5 +1,13 @@
 #pragma once
 
+#include <cstddef>
+
+#include <nonstd/optional.hpp>
+#include <nonstd/variant.hpp>
+#include <xtensor/xtensor.hpp>
+
+#include "ecole/utility/sparse_matrix.hpp"
+
 namespace ecole {
 
 namespace scip {
@@ -37,5 +45,35 @@ public:
 	virtual Observation obtain_observation(scip::Model& model) = 0;
 };
 
+/**
+ * Number of bytes held in the buffers of an observation, used for memory accounting.
+ *
+ * Observation types holding memory overload this function in the `ecole::observation`
+ * namespace.
+ * Types that are not recognized are counted as empty.
+ */
+template <typename T> std::size_t buffer_size(T const& /* observation */) noexcept {
+	return 0;
+}
+
+template <typename T, std::size_t N>
+std::size_t buffer_size(xt::xtensor<T, N> const& observation) noexcept {
+	return observation.size() * sizeof(T);
+}
+
+template <typename T>
+std::size_t buffer_size(utility::coo_matrix<T> const& observation) noexcept {
+	return buffer_size(observation.values) + buffer_size(observation.indices);
+}
+
+template <typename T> std::size_t buffer_size(nonstd::optional<T> const& observation) noexcept {
+	return observation.has_value() ? buffer_size(observation.value()) : 0;
+}
+
+template <typename... Ts>
+std::size_t buffer_size(nonstd::variant<Ts...> const& observation) noexcept {
+	return nonstd::visit([](auto const& obs) { return buffer_size(obs); }, observation);
+}
+
 }  // namespace observation
 }  // namespace ecole
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ecole/observation/abstract.hpp"
+#include "ecole/traits.hpp"
+
+namespace ecole {
+namespace observation {
+
+/**
+ * Adapt an observation function to return a more general observation type.
+ *
+ * Used to erase the type of observation functions, for instance with a variant observation.
+ *
+ * @tparam Observation the observation type returned, constructible from the observation of the
+ *         adapted function.
+ * @tparam Function the observation function adapted.
+ */
+template <typename Observation, typename Function>
+class AdaptedFunction : public ObservationFunction<Observation> {
+public:
+	AdaptedFunction(std::shared_ptr<Function> function) : function{std::move(function)} {}
+
+	void reset(scip::Model& model) override { function->reset(model); }
+
+	Observation obtain_observation(scip::Model& model) override {
+		return Observation{function->obtain_observation(model)};
+	}
+
+private:
+	std::shared_ptr<Function> function;
+};
+
+/**
+ * Observation function packing the observations of other functions in a map.
+ *
+ * The composition is resolved at runtime, with functions sharing a common observation type.
+ * Functions are called in insertion order, and are held by shared pointers, so copies of the
+ * DictFunction share the same functions.
+ *
+ * @tparam Observation the observation type of all composed functions.
+ */
+template <typename Observation>
+class DictFunction : public ObservationFunction<std::map<std::string, Observation>> {
+public:
+	using Function = ObservationFunction<Observation>;
+	using Functions = std::vector<std::pair<std::string, std::shared_ptr<Function>>>;
+
+	/** Add a function, replacing any function previously given the same name. */
+	void insert(std::string name, std::shared_ptr<Function> function) {
+		auto const same_name = [&name](auto const& name_func) { return name_func.first == name; };
+		auto const iter = std::find_if(functions.begin(), functions.end(), same_name);
+		if (iter != functions.end()) {
+			iter->second = std::move(function);
+		} else {
+			functions.emplace_back(std::move(name), std::move(function));
+		}
+	}
+
+	/** Add a function of another type, adapted to return the common observation type. */
+	template <typename OtherFunction>
+	void insert_adapted(std::string name, std::shared_ptr<OtherFunction> function) {
+		using Adapted = AdaptedFunction<Observation, OtherFunction>;
+		insert(std::move(name), std::make_shared<Adapted>(std::move(function)));
+	}
+
+	/** Reset all functions. */
+	void reset(scip::Model& model) override {
+		for (auto& name_func : functions) {
+			name_func.second->reset(model);
+		}
+	}
+
+	/** Extract the observation of all functions. */
+	std::map<std::string, Observation> obtain_observation(scip::Model& model) override {
+		auto observations = std::map<std::string, Observation>{};
+		for (auto& name_func : functions) {
+			observations.emplace(name_func.first, name_func.second->obtain_observation(model));
+		}
+		return observations;
+	}
+
+	Functions const& get() const noexcept { return functions; }
+
+private:
+	Functions functions;
+};
+
+/**
+ * Number of bytes held in the buffers of all observations in the map.
+ */
+template <typename Observation>
+std::size_t buffer_size(std::map<std::string, Observation> const& observations) noexcept {
+	auto size = std::size_t{0};
+	for (auto const& name_obs : observations) {
+		size += buffer_size(name_obs.second);
+	}
+	return size;
+}
+
+}  // namespace observation
+}  // namespace ecole
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include <nonstd/optional.hpp>
 #include <xtensor/xtensor.hpp>
 
@@ -18,6 +20,11 @@ public:
 	utility::coo_matrix<value_type> edge_features;
 };
 
+inline std::size_t buffer_size(NodeBipartiteObs const& observation) noexcept {
+	return buffer_size(observation.column_features) + buffer_size(observation.row_features) +
+				 buffer_size(observation.edge_features);
+}
+
 class NodeBipartite : public ObservationFunction<nonstd::optional<NodeBipartiteObs>> {
 public:
 	using Observation = nonstd::optional<NodeBipartiteObs>;
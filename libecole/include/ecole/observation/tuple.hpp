@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+
+#include "ecole/observation/abstract.hpp"
+#include "ecole/traits.hpp"
+
+namespace ecole {
+namespace observation {
+
+/**
+ * Observation function packing the observations of other functions in a tuple.
+ *
+ * The composition is resolved at compile time, so that all observations are extracted in a
+ * single call without any dynamic dispatch.
+ *
+ * @tparam Functions the observation functions composed.
+ */
+template <typename... Functions>
+class TupleFunction
+	: public ObservationFunction<std::tuple<trait::observation_of_t<Functions>...>> {
+public:
+	using Observation = std::tuple<trait::observation_of_t<Functions>...>;
+
+	TupleFunction(Functions... functions) : functions{std::move(functions)...} {}
+
+	/** Reset all functions, in order. */
+	void reset(scip::Model& model) override {
+		reset_impl(model, std::index_sequence_for<Functions...>{});
+	}
+
+	/** Extract the observation of all functions, in order. */
+	Observation obtain_observation(scip::Model& model) override {
+		return obtain_observation_impl(model, std::index_sequence_for<Functions...>{});
+	}
+
+	/** The composed functions. */
+	std::tuple<Functions...>& get() noexcept { return functions; }
+	std::tuple<Functions...> const& get() const noexcept { return functions; }
+
+private:
+	std::tuple<Functions...> functions;
+
+	template <std::size_t... I> void reset_impl(scip::Model& model, std::index_sequence<I...>) {
+		// Trick to call a function on all elements of a tuple in order, before C++17 folds
+		(void)std::initializer_list<int>{(std::get<I>(functions).reset(model), 0)...};
+	}
+
+	template <std::size_t... I>
+	Observation obtain_observation_impl(scip::Model& model, std::index_sequence<I...>) {
+		// Braced initialization guarantees left to right evaluation
+		return Observation{std::get<I>(functions).obtain_observation(model)...};
+	}
+};
+
+/**
+ * Build a TupleFunction deducing the type of the functions.
+ */
+template <typename... Functions> auto make_tuple_function(Functions... functions) {
+	return TupleFunction<Functions...>{std::move(functions)...};
+}
+
+/**
+ * Number of bytes held in the buffers of all observations in the tuple.
+ */
+template <typename... Observations>
+std::size_t buffer_size(std::tuple<Observations...> const& observations) noexcept;
+
+namespace internal {
+
+template <typename Tuple, std::size_t... I>
+std::size_t tuple_buffer_size(Tuple const& observations, std::index_sequence<I...>) noexcept {
+	auto size = std::size_t{0};
+	(void)std::initializer_list<int>{(size += buffer_size(std::get<I>(observations)), 0)...};
+	return size;
+}
+
+}  // namespace internal
+
+template <typename... Observations>
+std::size_t buffer_size(std::tuple<Observations...> const& observations) noexcept {
+	return internal::tuple_buffer_size(observations, std::index_sequence_for<Observations...>{});
+}
+
+}  // namespace observation
+}  // namespace ecole
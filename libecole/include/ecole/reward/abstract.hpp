@@ -20,6 +20,14 @@ class RewardFunction {
 public:
 	virtual ~RewardFunction() = default;
 
+	/**
+	 * The method called by the environment before bringing the model to its initial state.
+	 *
+	 * The model is not transformed yet, which is the time to include plugins in the solver.
+	 * Does nothing by default.
+	 */
+	virtual void before_reset(scip::Model& /* model */) {}
+
 	/**
 	 * The method called by the environment on the initial state
 	 *
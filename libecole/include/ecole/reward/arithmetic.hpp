@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+
+#include "ecole/reward/abstract.hpp"
+
+namespace ecole {
+namespace reward {
+
+/**
+ * Reward function applying an operation on the reward of another reward function.
+ *
+ * Together with BinaryArithmetic, it forms expression trees of reward functions that are
+ * evaluated without leaving C++.
+ */
+class UnaryArithmetic : public RewardFunction {
+public:
+	using Operation = Reward (*)(Reward);
+
+	UnaryArithmetic(Operation operation, std::shared_ptr<RewardFunction> operand);
+
+	void before_reset(scip::Model& model) override;
+	void reset(scip::Model const& model) override;
+	Reward obtain_reward(scip::Model const& model, bool done = false) override;
+
+private:
+	Operation operation;
+	std::shared_ptr<RewardFunction> operand;
+};
+
+/**
+ * Reward function applying an operation on the rewards of two other reward functions.
+ */
+class BinaryArithmetic : public RewardFunction {
+public:
+	using Operation = Reward (*)(Reward, Reward);
+
+	BinaryArithmetic(
+		Operation operation,
+		std::shared_ptr<RewardFunction> left,
+		std::shared_ptr<RewardFunction> right);
+
+	void before_reset(scip::Model& model) override;
+	void reset(scip::Model const& model) override;
+	Reward obtain_reward(scip::Model const& model, bool done = false) override;
+
+private:
+	Operation operation;
+	std::shared_ptr<RewardFunction> left;
+	std::shared_ptr<RewardFunction> right;
+};
+
+}  // namespace reward
+}  // namespace ecole
@@ -11,8 +11,17 @@ public:
 	void reset(scip::Model const& model) override;
 	Reward obtain_reward(scip::Model const& model, bool done = false) override;
 
+	/**
+	 * Root LP iterations saved in the episode by warm starting from a root basis cache.
+	 *
+	 * The saved iterations are not done, so they are not counted in the rewards.
+	 * Updated on every reward.
+	 */
+	scip::long_int lp_iterations_saved() const noexcept { return m_lp_iterations_saved; }
+
 private:
 	scip::long_int last_lp_iter = 0;
+	scip::long_int m_lp_iterations_saved = 0;
 };
 
 }  // namespace reward
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+
+#include "ecole/reward/abstract.hpp"
+
+namespace ecole {
+namespace reward {
+
+/**
+ * Primal-dual integral since the previous state (negated).
+ *
+ * The integral of the primal-dual gap function over the solving time, as defined by Berthold,
+ * where the gap is in [0, 1] and is 1 as long as a bound is infinite.
+ * The gap is piecewise constant, sampled on the solver thread by an event handler included in
+ * the model before reset, on every event where a global bound can change: new best solution,
+ * LP solved, node solved or focused, and presolving round.
+ * The gap is also sampled at every state.
+ */
+class PrimalDualIntegral : public RewardFunction {
+public:
+	/** Integral of the gap function, updated by the event handler. */
+	struct Integral;
+
+	void before_reset(scip::Model& model) override;
+	void reset(scip::Model const& model) override;
+	Reward obtain_reward(scip::Model const& model, bool done = false) override;
+
+private:
+	std::shared_ptr<Integral> integral;
+	double last_integral = 0.;
+};
+
+}  // namespace reward
+}  // namespace ecole
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+
+#include "ecole/reward/abstract.hpp"
+#include "ecole/scip/type.hpp"
+
+namespace ecole {
+namespace reward {
+
+/**
+ * Several progress rewards computed together from a single statistics snapshot.
+ *
+ * Each component has the same value as the corresponding reward function (LpIterations,
+ * NNodes, TreeSize, SolvingTime), but the stage checks are done only once for all of them.
+ * It is not a RewardFunction since it returns several values.
+ */
+class Progress {
+public:
+	struct Rewards {
+		Reward lp_iterations = 0.;
+		Reward n_nodes = 0.;
+		Reward tree_size = 0.;
+		Reward solving_time = 0.;
+	};
+
+	void reset(scip::Model const& model);
+	Rewards obtain_rewards(scip::Model const& model, bool done = false);
+
+private:
+	scip::long_int last_lp_iter = 0;
+	scip::long_int last_n_nodes = 0;
+	scip::real last_tree_size = 0.;
+	std::chrono::nanoseconds last_time{0};
+};
+
+}  // namespace reward
+}  // namespace ecole
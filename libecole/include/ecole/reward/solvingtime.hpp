@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+
+#include "ecole/reward/abstract.hpp"
+
+namespace ecole {
+namespace reward {
+
+/**
+ * Time spent by the solver since the previous state, in seconds (negated).
+ *
+ * Time is measured with nanosecond resolution, only while the solver runs, so that the time
+ * spent in the environment and waiting on the solving thread is excluded.
+ * By default, the CPU time of the solving thread is used, which does not depend on the load of
+ * the machine.
+ */
+class SolvingTime : public RewardFunction {
+public:
+	SolvingTime(bool wall_ = false) noexcept : wall(wall_) {}
+
+	void reset(scip::Model const& model) override;
+	Reward obtain_reward(scip::Model const& model, bool done = false) override;
+
+	/** Whether to use wall clock time rather than thread CPU time. */
+	bool const wall = false;
+
+private:
+	std::chrono::nanoseconds last_time{0};
+
+	std::chrono::nanoseconds solver_time(scip::Model const& model) const noexcept;
+};
+
+}  // namespace reward
+}  // namespace ecole
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "ecole/reward/abstract.hpp"
+#include "ecole/scip/type.hpp"
+
+namespace ecole {
+namespace reward {
+
+/**
+ * Difference in the estimated size of the search tree (negated).
+ *
+ * While SCIP cannot estimate the tree size, the last estimate is kept, and the reward is zero.
+ */
+class TreeSize : public RewardFunction {
+public:
+	void reset(scip::Model const& model) override;
+	Reward obtain_reward(scip::Model const& model, bool done = false) override;
+
+private:
+	scip::real last_tree_size = 0.;
+};
+
+}  // namespace reward
+}  // namespace ecole
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "ecole/scip/type.hpp"
+
+namespace ecole {
+namespace scip {
+
+/**
+ * Basis status of an LP, identified by column (variable) and row names.
+ *
+ * Names make the basis independent of the order of variables and constraints, so that it can be
+ * used with any permutation of the same problem.
+ */
+struct LpBasis {
+	std::unordered_map<std::string, base_stat> columns;
+	std::unordered_map<std::string, base_stat> rows;
+	/** LP iterations needed to find this basis from scratch. */
+	long_int lp_iterations = 0;
+};
+
+/**
+ * Optimal root LP bases of problem instances, keyed by instance fingerprint.
+ *
+ * The cache is filled by models with root warm start enabled on their first (cold) solve, and the
+ * basis is installed as a warm start in the root LP of subsequent solves of the same instance.
+ * The class is thread safe and meant to be shared among models and environments.
+ *
+ * @see Model::enable_root_warm_start
+ */
+class RootBasisCache {
+public:
+	/**
+	 * The basis of an instance, or `nullptr` if not cached.
+	 *
+	 * The basis holds the LP iterations of the cold root LP solve of the instance.
+	 */
+	std::shared_ptr<LpBasis const> get(std::uint64_t fingerprint) const;
+	/**
+	 * Add the basis of an instance, unless one is already present.
+	 */
+	void insert(std::uint64_t fingerprint, LpBasis basis);
+
+	std::size_t size() const;
+	void clear();
+
+	/**
+	 * Record the LP iterations of a root solved from a warm start.
+	 */
+	void record_warm_start(long_int lp_iterations_saved) noexcept;
+	/**
+	 * Number of root LP solved from a warm start.
+	 */
+	std::size_t n_warm_starts() const noexcept;
+	/**
+	 * Root LP iterations saved compared to the cold solves of the same instances.
+	 */
+	long_int lp_iterations_saved() const noexcept;
+
+private:
+	mutable std::mutex mutex;
+	std::unordered_map<std::uint64_t, std::shared_ptr<LpBasis const>> bases;
+	std::size_t m_n_warm_starts = 0;
+	long_int m_lp_iterations_saved = 0;
+};
+
+}  // namespace scip
+}  // namespace ecole
@@ -2,6 +2,7 @@
 
 #include <nonstd/optional.hpp>
 #include <scip/scip.h>
+#include <xtensor/xtensor.hpp>
 
 #include "ecole/scip/type.hpp"
 #include "ecole/scip/variable.hpp"
@@ -32,5 +33,22 @@ public:
 
 using ColView = View<ColProxy>;
 
+/**
+ * Structure of arrays holding the attributes of all LP columns.
+ *
+ * Element `i` of every array is an attribute of the `i`-th LP column.
+ * Infinite bounds are stored as IEEE infinities.
+ *
+ * @see Model::lp_columns_arrays
+ */
+struct ColArrays {
+	xt::xtensor<real, 1> lb;
+	xt::xtensor<real, 1> ub;
+	xt::xtensor<real, 1> obj;
+	xt::xtensor<real, 1> prim_sol;
+	xt::xtensor<real, 1> reduced_cost;
+	xt::xtensor<base_stat, 1> basis_status;
+};
+
 }  // namespace scip
 }  // namespace ecole
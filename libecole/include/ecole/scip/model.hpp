@@ -2,17 +2,25 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include <nonstd/span.hpp>
 #include <scip/scip.h>
 
+#include "ecole/scip/basis-cache.hpp"
 #include "ecole/scip/column.hpp"
+#include "ecole/scip/plugins.hpp"
 #include "ecole/scip/row.hpp"
+#include "ecole/scip/type.hpp"
 #include "ecole/scip/variable.hpp"
+#include "ecole/utility/chrono.hpp"
 
 namespace ecole {
 namespace scip {
@@ -34,6 +42,10 @@ public:
 	 * Construct an *initialized* model with default SCIP plugins.
 	 */
 	Model();
+	/**
+	 * Construct an *initialized* model with the plugins of the given profile.
+	 */
+	explicit Model(PluginProfile profile);
 	Model(Model&&) noexcept;
 	Model(Model const& model) = delete;
 	Model(std::unique_ptr<Scimpl>&&);
@@ -51,6 +63,13 @@ public:
 	 */
 	SCIP* get_scip_ptr() const noexcept;
 
+	/**
+	 * The profile of the plugins the model was created with.
+	 *
+	 * Full for SCIP objects not created by Ecole, which may have any plugins.
+	 */
+	PluginProfile plugin_profile() const noexcept;
+
 	Model copy_orig() const;
 
 	/**
@@ -61,14 +80,72 @@ public:
 
 	/**
 	 * Construct a model by reading a problem file supported by SCIP (LP, MPS,...).
+	 *
+	 * The reader of the file format must be part of the plugin profile.
 	 */
-	static Model from_file(std::string const& filename);
+	static Model
+	from_file(std::string const& filename, PluginProfile profile = PluginProfile::Full);
 
 	/**
 	 * Read a problem file into the Model.
 	 */
 	void read_prob(std::string const& filename);
 
+	/**
+	 * Construct a model by parsing a problem held in memory.
+	 *
+	 * The format is given as the file extension of the SCIP reader to use (`"mps"`,
+	 * `"lp"`,...).
+	 * On Linux, the buffer is parsed from an in-memory file, without writing to disk.
+	 * Elsewhere (or without `memfd_create`), it is copied in an unlinked temporary file, which
+	 * may be written to disk.
+	 * The reader of the format must be part of the plugin profile.
+	 */
+	static Model from_buffer(
+		nonstd::span<char const> buffer,
+		std::string const& format,
+		PluginProfile profile = PluginProfile::Full);
+
+	/**
+	 * Read a problem held in memory into the Model.
+	 *
+	 * @see from_buffer
+	 */
+	void read_prob_buffer(nonstd::span<char const> buffer, std::string const& format);
+
+	/**
+	 * Write the original problem into a memory buffer using the given format.
+	 *
+	 * The format is given as the file extension of the SCIP reader to use.
+	 */
+	std::vector<char>
+	write_orig_prob_buffer(std::string const& format, bool generic_names = false) const;
+
+	/**
+	 * Construct a model from a binary snapshot of an original problem.
+	 *
+	 * Snapshots store the variables, the objective, and the linear constraints as contiguous
+	 * arrays that are loaded in bulk, which is much faster than parsing text formats.
+	 *
+	 * @see write_snapshot
+	 */
+	static Model
+	from_snapshot(nonstd::span<char const> buffer, PluginProfile profile = PluginProfile::Full);
+
+	/**
+	 * Construct a model from a snapshot file, mapping the file in memory.
+	 */
+	static Model from_snapshot_file(std::string const& filename);
+
+	/**
+	 * Write a binary snapshot of the original problem.
+	 *
+	 * Only problems made of linear constraints (such as those read from MPS and LP files) are
+	 * supported.
+	 */
+	std::vector<char> write_snapshot() const;
+	void write_snapshot_file(std::string const& filename) const;
+
 	Stage get_stage() const noexcept;
 
 	ParamType get_param_type(std::string const& name) const;
@@ -98,6 +175,14 @@ public:
 
 	void set_params(std::map<std::string, Param> name_values);
 	std::map<std::string, Param> get_params() const;
+	/**
+	 * Get the parameters whose value differ from SCIP default.
+	 */
+	std::map<std::string, Param> get_non_default_params() const;
+	/**
+	 * Set all parameters back to their default value.
+	 */
+	void reset_params();
 
 	void disable_presolve();
 	void disable_cuts();
@@ -113,11 +198,111 @@ public:
 	void solve_iter_stop();
 	bool solve_iter_is_done();
 
+	/**
+	 * Go back to the original problem, stopping any iterative solving.
+	 *
+	 * The SCIP object, its plugins, and the original problem are kept, so that the same
+	 * instance can be solved again without being read or copied.
+	 * The solver time and peak memory restart from zero, as for a new model.
+	 */
+	void free_transform();
+
+	/**
+	 * Thread CPU and wall time spent by the solver in solve and solve_iter calls.
+	 *
+	 * Only the time the solver actually runs is counted, not the time it waits for the
+	 * environment between iterations.
+	 */
+	utility::Durations solver_time() const noexcept;
+
+	/**
+	 * Memory used by the underlying SCIP solver.
+	 */
+	MemoryStats memory_stats() const;
+	/**
+	 * Gather the solver statistics in a single call, valid in any stage.
+	 *
+	 * Cheap enough to be called at every transition.
+	 */
+	SolverStats stats() const;
+	/**
+	 * Individual statistics of stats(), valid in any stage, without the memory statistics.
+	 *
+	 * Cheaper than stats() when only one of them is needed, such as in reward functions.
+	 */
+	long_int n_nodes() const noexcept;
+	long_int n_lp_iterations() const noexcept;
+	real tree_size_estimate() const noexcept;
+
+	/**
+	 * Capture the solver output in a bounded in-memory ring buffer.
+	 *
+	 * Messages are copied in the buffer without any I/O, the oldest being overwritten once the
+	 * capacity (in bytes) is reached.
+	 * When capture is enabled, exceptions raised while solving include the tail of the log.
+	 * Enabling the capture again starts a new empty buffer.
+	 */
+	void enable_log_capture(std::size_t capacity = default_log_capacity);
+	/**
+	 * Go back to a quiet solver, discarding the captured log.
+	 */
+	void disable_log_capture();
+	/**
+	 * The last (at most) `max_size` characters of captured log, or an empty string if disabled.
+	 *
+	 * Can be called from any thread, including while the Model is solving.
+	 */
+	std::string log_tail(std::size_t max_size = std::numeric_limits<std::size_t>::max()) const;
+
+	static constexpr std::size_t default_log_capacity = 1U << 16U;
+
+	/**
+	 * Hash of the original problem, identifying the instance.
+	 *
+	 * Computed from the objective sense and offset, variables (names, bounds, objective, types) and
+	 * constraints (names, handlers, sides, variables, and coefficients), so it does not depend on
+	 * the file the problem was read from.
+	 */
+	std::uint64_t fingerprint() const;
+
+	/**
+	 * Warm start the root LP of the next solves from the basis cached for this instance.
+	 *
+	 * If no basis is cached, the optimal root LP basis of the next solve is added to the cache.
+	 * The basis is matched by names, and ignored if the root LP differs from the cached one.
+	 * Resetting parameters to their default disables the warm start.
+	 */
+	void enable_root_warm_start(std::shared_ptr<RootBasisCache> cache);
+	/**
+	 * Root LP iterations saved by the warm start in the current solve, compared to the cold solve.
+	 *
+	 * Zero if the root LP was not warm started.
+	 * The LP iterations of the cold solve are those of the basis in the cache.
+	 */
+	long_int root_lp_iterations_saved() const noexcept;
+
 	VarView variables() const noexcept;
 	VarView lp_branch_cands() const noexcept;
 	ColView lp_columns() const;
 	RowView lp_rows() const;
 
+	/**
+	 * Extract the attributes of all LP columns in contiguous arrays.
+	 *
+	 * Faster than iterating over @ref lp_columns when many attributes are needed.
+	 * The overload taking arrays reuses their memory when the size is unchanged.
+	 */
+	ColArrays lp_columns_arrays() const;
+	void lp_columns_arrays(ColArrays& arrays) const;
+	/**
+	 * Extract the attributes of all LP rows in contiguous arrays.
+	 *
+	 * Faster than iterating over @ref lp_rows when many attributes are needed.
+	 * The overload taking arrays reuses their memory when the size is unchanged.
+	 */
+	RowArrays lp_rows_arrays() const;
+	void lp_rows_arrays(RowArrays& arrays) const;
+
 private:
 	std::unique_ptr<Scimpl> scimpl;
 };
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+
+#include <scip/scip.h>
+
+namespace ecole {
+namespace scip {
+
+/**
+ * Sets of SCIP plugins that can be included in a Model.
+ *
+ * - `Full` ("full"): all default SCIP plugins, as `SCIPincludeDefaultPlugins`.
+ * - `MinimalBranching` ("minimal-branching"): the plugins needed to read and branch on linear
+ *   MILPs with presolving and cuts disabled (linear constraint handlers, LP, MPS and CIP readers,
+ *   node selectors, a few branching rules and trivial heuristics).
+ *   Other problems, or parameters of missing plugins, are not supported.
+ */
+enum class PluginProfile { Full, MinimalBranching };
+
+/**
+ * Get a plugin profile from its name ("full", "minimal-branching").
+ */
+PluginProfile plugin_profile_from_string(std::string const& name);
+
+/**
+ * Get the name of a plugin profile.
+ */
+std::string to_string(PluginProfile profile);
+
+/**
+ * Include the plugins of a profile in a SCIP in `SCIP_STAGE_INIT`.
+ */
+void include_plugins(SCIP* scip, PluginProfile profile);
+
+}  // namespace scip
+}  // namespace ecole
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <scip/scip.h>
+
+#include "ecole/scip/plugins.hpp"
+
+namespace ecole {
+namespace scip {
+
+/**
+ * A pool of SCIP objects kept for reuse once their Model is destroyed.
+ *
+ * Creating a `SCIP*` and including the default plugins is a visible part of creating a Model.
+ * When enabled (non zero capacity), the SCIP objects of destroyed models are returned to the
+ * pool, with their problem freed and their parameters reset to default.
+ * New models, including the ones made by @ref Model::from_file and @ref Model::copy_orig, then
+ * reuse them rather than building a new one.
+ *
+ * Only SCIP objects with the plugins of a PluginProfile (as created by Ecole) are recycled, and
+ * they are kept separately for each profile.
+ * The plugins that Ecole adds in environments (dynamics, rewards, and root warm start) are
+ * allowed, as they are inactive outside of an episode and reused by the next ones.
+ * SCIP objects to which other plugins were added are freed rather than recycled.
+ * The pool is disabled by default.
+ * The class is thread safe.
+ */
+class ModelPool {
+public:
+	/**
+	 * The pool used by all models.
+	 */
+	static ModelPool& global();
+
+	explicit ModelPool(std::size_t capacity = 0) noexcept;
+	ModelPool(ModelPool const&) = delete;
+	ModelPool& operator=(ModelPool const&) = delete;
+	~ModelPool();
+
+	/**
+	 * Maximum number of SCIP objects kept for each PluginProfile.
+	 */
+	std::size_t capacity() const;
+	/**
+	 * Change the capacity, freeing SCIP objects in excess.
+	 */
+	void set_capacity(std::size_t new_capacity);
+	/**
+	 * Number of SCIP objects currently available in the pool.
+	 */
+	std::size_t size() const;
+	/**
+	 * Free all pooled SCIP objects.
+	 */
+	void clear();
+
+	/**
+	 * Take a SCIP object from the pool.
+	 *
+	 * The object is in `SCIP_STAGE_INIT`, has default parameters and the plugins of the profile.
+	 * Ownership is transfered to the caller.
+	 *
+	 * @return A SCIP pointer, or `nullptr` if the pool has none for this profile.
+	 */
+	SCIP* acquire(PluginProfile profile = PluginProfile::Full);
+	/**
+	 * Give back a SCIP object created with the plugins of the profile.
+	 *
+	 * The object is cleaned and kept in the pool if there is space left and it has exactly the
+	 * plugins of the profile, besides the ones of Ecole, otherwise it is freed.
+	 * Ownership is transfered to the pool.
+	 */
+	void release(SCIP* scip, PluginProfile profile = PluginProfile::Full) noexcept;
+
+private:
+	mutable std::mutex mutex;
+	std::size_t m_capacity;
+	std::map<PluginProfile, std::vector<SCIP*>> scips;
+	/** Number of plugins of every kind in a new SCIP object, for each profile. */
+	std::map<PluginProfile, std::array<int, 13>> profile_counts;
+
+	bool has_profile_plugins(SCIP* scip, PluginProfile profile) noexcept;
+};
+
+}  // namespace scip
+}  // namespace ecole
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nonstd/span.hpp>
+
+#include "ecole/scip/model.hpp"
+
+namespace ecole {
+namespace scip {
+
+/**
+ * A variable of an original problem, as an affine function of the presolved problem variables.
+ */
+struct AffineVar {
+	std::string name;
+	SCIP_Real constant = 0.;
+	/** Presolved variables, by index in the presolved model variables, and their coefficient. */
+	std::vector<std::pair<std::size_t, SCIP_Real>> terms;
+};
+
+/**
+ * The problem of a model after presolving, with the mapping back to the original variables.
+ *
+ * The presolved problem is the original problem of its own model, so that it can be copied and
+ * solved with presolving disabled.
+ */
+class PresolvedProblem {
+public:
+	/**
+	 * Presolve a copy of the original problem of the model, with its parameters.
+	 *
+	 * @throw scip::Exception if presolving ends the solve (see @ref try_presolve).
+	 */
+	static PresolvedProblem presolve(Model const& model);
+	/**
+	 * Presolve a copy of the original problem of the model, or return null if presolving ends
+	 * the solve.
+	 *
+	 * Presolving ends the solve when it solves the problem, proves it infeasible or unbounded, or
+	 * hits a limit, in which case what is left of the problem is not equivalent to the original.
+	 */
+	static std::unique_ptr<PresolvedProblem> try_presolve(Model const& model);
+
+	/** The model whose original problem is the presolved problem. */
+	Model const& model() const noexcept { return m_model; }
+	/** The variables of the original problem, in the order of the original model. */
+	std::vector<AffineVar> const& original_variables() const noexcept { return m_original_vars; }
+	/** Wall time spent presolving. */
+	std::chrono::nanoseconds presolve_time() const noexcept { return m_presolve_time; }
+
+	/**
+	 * Values of the original variables, from the values of the presolved problem variables.
+	 */
+	std::vector<SCIP_Real> to_original(nonstd::span<SCIP_Real const> values) const;
+
+private:
+	Model m_model;
+	std::vector<AffineVar> m_original_vars;
+	std::chrono::nanoseconds m_presolve_time{0};
+
+	PresolvedProblem(
+		Model model,
+		std::vector<AffineVar> original_vars,
+		std::chrono::nanoseconds presolve_time) noexcept;
+};
+
+/**
+ * Presolved problems, keyed by instance fingerprint and parameters that can affect presolving.
+ *
+ * Random seeds are not part of the key, so a cached presolved problem is reused whatever the seeds
+ * of the later episodes.
+ * Do not use a cache when seeds should affect presolving.
+ * The class is thread safe and meant to be shared among environments.
+ */
+class PresolveCache {
+public:
+	/**
+	 * Hash of the original problem of the model and of its non default parameters, except seeds.
+	 */
+	static std::uint64_t key(Model const& model);
+
+	/**
+	 * The presolved problem of the model, presolving it if not cached.
+	 *
+	 * Null if presolving ends the solve, in which case the original problem must be solved.
+	 * This outcome is also cached.
+	 */
+	std::shared_ptr<PresolvedProblem const> get_or_presolve(Model const& model);
+
+	std::size_t size() const;
+	void clear();
+
+	/** Number of presolved problems found in the cache. */
+	std::size_t n_hits() const noexcept;
+	/** Number of problems presolved because they were not in the cache. */
+	std::size_t n_misses() const noexcept;
+	/** Presolving time of the problems found in the cache. */
+	std::chrono::nanoseconds time_saved() const noexcept;
+
+private:
+	mutable std::mutex mutex;
+	std::unordered_map<std::uint64_t, std::shared_ptr<PresolvedProblem const>> problems;
+	std::size_t m_n_hits = 0;
+	std::size_t m_n_misses = 0;
+	std::chrono::nanoseconds m_time_saved{0};
+};
+
+}  // namespace scip
+}  // namespace ecole
@@ -2,6 +2,7 @@
 
 #include <nonstd/optional.hpp>
 #include <scip/scip.h>
+#include <xtensor/xtensor.hpp>
 
 #include "ecole/scip/type.hpp"
 #include "ecole/scip/view.hpp"
@@ -36,5 +37,22 @@ public:
 
 using RowView = View<RowProxy>;
 
+/**
+ * Structure of arrays holding the attributes of all LP rows.
+ *
+ * Element `i` of every array is an attribute of the `i`-th LP row.
+ * As with RowProxy, sides and activity do not include the row constant, and infinite sides are
+ * stored as IEEE infinities.
+ *
+ * @see Model::lp_rows_arrays
+ */
+struct RowArrays {
+	xt::xtensor<real, 1> lhs;
+	xt::xtensor<real, 1> rhs;
+	xt::xtensor<real, 1> l2_norm;
+	xt::xtensor<real, 1> lp_activity;
+	xt::xtensor<real, 1> dual_sol;
+};
+
 }  // namespace scip
 }  // namespace ecole
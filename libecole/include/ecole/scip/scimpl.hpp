@@ -1,35 +1,69 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string>
 
 #include <scip/scip.h>
 
+#include "ecole/scip/plugins.hpp"
+#include "ecole/scip/type.hpp"
+#include "ecole/utility/chrono.hpp"
 #include "ecole/utility/reverse-control.hpp"
 
 namespace ecole {
 namespace scip {
 
+/* Forward declare internal log capture type */
+class LogRing;
+
+/**
+ * Deleter for SCIP pointers.
+ *
+ * SCIP objects with the plugins of a PluginProfile can be recycled, _i.e._ given back to the
+ * global ModelPool.
+ */
 struct ScipDeleter {
+	bool recycle = false;
+	PluginProfile profile = PluginProfile::Full;
+
 	void operator()(SCIP* ptr);
 };
 
 class Scimpl {
 public:
-	Scimpl();
+	Scimpl(PluginProfile profile = PluginProfile::Full);
 	Scimpl(std::unique_ptr<SCIP, ScipDeleter>&&) noexcept;
 
 	SCIP* get_scip_ptr() noexcept;
+	PluginProfile plugin_profile() const noexcept;
 
 	Scimpl copy_orig();
 
+	void solve();
 	void solve_iter();
 	void solve_iter_branch(SCIP_VAR* var);
 	void solve_iter_stop();
 	bool solve_iter_is_done();
+	void free_transform();
+
+	MemoryStats memory_stats();
+	utility::Durations solver_time() const noexcept;
+
+	void enable_log_capture(std::size_t capacity);
+	void disable_log_capture();
+	std::string log_tail(std::size_t max_size) const;
 
 private:
 	std::unique_ptr<SCIP, ScipDeleter> m_scip = nullptr;
 	std::unique_ptr<utility::Controller> m_controller = nullptr;
+	std::size_t peak_memory = 0;
+	std::shared_ptr<LogRing> log_ring = nullptr;
+	/** Solver time of calls to solve and of previous Controllers. */
+	utility::Durations past_solver_time;
+
+	void sample_memory() noexcept;
+	void stop_controller() noexcept;
 };
 
 }  // namespace scip
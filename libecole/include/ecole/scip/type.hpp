@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 #include <nonstd/variant.hpp>
@@ -48,6 +49,41 @@ constexpr Seed max_seed = 2147483647;
 
 using Stage = SCIP_STAGE;
 
+/**
+ * Memory used by a SCIP solver, in bytes.
+ */
+struct MemoryStats {
+	/** Block and buffer memory currently in use by SCIP. */
+	std::size_t used = 0;
+	/** Block and buffer memory currently allocated by SCIP (in use or cached for reuse). */
+	std::size_t total = 0;
+	/** Largest total memory seen, sampled at every branching and statistics query. */
+	std::size_t peak = 0;
+	/** SCIP estimate of memory allocated outside its own allocators (LP solver...). */
+	std::size_t external = 0;
+};
+
+/**
+ * Snapshot of the solver progress.
+ *
+ * Values not yet available in the current stage are left to their defaults.
+ * Bounds and gap use SCIP infinity.
+ */
+struct SolverStats {
+	long_int n_nodes = 0;
+	long_int n_lp_iterations = 0;
+	real primal_bound = 0.;
+	real dual_bound = 0.;
+	real gap = 0.;
+	/** Solving time in seconds, as measured by SCIP clocks. */
+	real solving_time = 0.;
+	/** Depth of the current node, or -1 outside of the tree search. */
+	int depth = -1;
+	/** Estimated number of nodes of the complete tree search, or -1 if unknown. */
+	real tree_size_estimate = -1.;
+	MemoryStats memory;
+};
+
 /**
  * Class template to store the number of elements in Scip enums.
  *
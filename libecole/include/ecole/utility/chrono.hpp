@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <utility>
+
+namespace ecole {
+namespace utility {
+
+/**
+ * CPU and wall clock durations.
+ */
+struct Durations {
+	std::chrono::nanoseconds cpu{0};
+	std::chrono::nanoseconds wall{0};
+
+	Durations& operator+=(Durations const& other) noexcept {
+		cpu += other.cpu;
+		wall += other.wall;
+		return *this;
+	}
+};
+
+/**
+ * CPU time consumed by the calling thread.
+ */
+std::chrono::nanoseconds thread_cpu_time() noexcept;
+
+/**
+ * Measure the CPU time of the calling thread, and the wall time, since construction.
+ *
+ * The thread CPU clock only counts the time the thread is scheduled, which excludes time
+ * spent waiting on other threads.
+ */
+class ThreadTimer {
+public:
+	ThreadTimer() noexcept;
+
+	Durations elapsed() const noexcept;
+
+private:
+	std::chrono::nanoseconds cpu_start;
+	std::chrono::steady_clock::time_point wall_start;
+};
+
+/**
+ * Call a function, adding its wall time to the given duration.
+ */
+template <typename Func> auto time_call(std::chrono::nanoseconds& duration, Func&& func) {
+	auto const start = std::chrono::steady_clock::now();
+	auto result = std::forward<Func>(func)();
+	duration +=
+		std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+	return result;
+}
+
+}  // namespace utility
+}  // namespace ecole
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <condition_variable>
 #include <exception>
@@ -11,6 +12,8 @@
 
 #include <scip/scip.h>
 
+#include "ecole/utility/chrono.hpp"
+
 namespace ecole {
 namespace utility {
 
@@ -26,6 +29,12 @@ public:
 	auto wait_thread() -> void;
 	auto resume_thread(action_func_t&& action_func) -> void;
 	auto is_done() const noexcept -> bool;
+	/**
+	 * CPU and wall time spent by the solving thread while owning the model.
+	 *
+	 * The time waiting for the environment is excluded.
+	 */
+	auto thread_time() const noexcept -> Durations;
 
 private:
 	class Synchronizer {
@@ -40,6 +49,7 @@ private:
 		auto thread_terminate(lock_t&& lk) -> void;
 		auto thread_terminate(lock_t&& lk, std::exception_ptr&& e) -> void;
 		auto thread_action_function(lock_t const& lk) const noexcept -> action_func_t;
+		auto thread_time() const noexcept -> Durations;
 
 	private:
 		std::exception_ptr except_ptr = nullptr;
@@ -48,7 +58,11 @@ private:
 		bool thread_owns_model = true;
 		bool thread_finished = false;
 		action_func_t action_func;
+		ThreadTimer timer;
+		std::atomic<std::chrono::nanoseconds::rep> cpu_time{0};
+		std::atomic<std::chrono::nanoseconds::rep> wall_time{0};
 
+		auto record_thread_time() noexcept -> void;
 		auto validate_lock(lock_t const& lk) const noexcept -> void;
 		auto maybe_throw(lock_t&& lk) -> lock_t;
 	};
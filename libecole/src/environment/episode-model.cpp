@@ -0,0 +1,72 @@
+#include <utility>
+
+#include "ecole/environment/episode-model.hpp"
+#include "ecole/environment/exception.hpp"
+#include "ecole/environment/memory.hpp"
+
+namespace ecole {
+namespace environment {
+
+void EpisodeModel::reset(scip::Model&& new_model) {
+	m_model = std::move(new_model);
+	m_presolved_problem = nullptr;
+	has_instance = false;
+	instance_filename.clear();
+	instance_params.clear();
+	if (reuse_model()) {
+		has_instance = true;
+		instance_fingerprint = m_model.fingerprint();
+		instance_params = m_model.get_non_default_params();
+	}
+	prepare_model();
+}
+
+void EpisodeModel::reset(scip::Model const& model) {
+	if (reuse_model() && has_instance && (model.fingerprint() == instance_fingerprint)) {
+		return reset_same_instance();
+	}
+	reset(model.copy_orig());
+}
+
+void EpisodeModel::reset(std::string const& filename) {
+	if (reuse_model() && has_instance && (filename == instance_filename)) {
+		return reset_same_instance();
+	}
+	reset(scip::Model::from_file(filename));
+	instance_filename = filename;
+}
+
+void EpisodeModel::reset(instance::InstancePrefetcher& prefetcher) {
+	auto model = prefetcher.next();
+	if (!model) throw Exception("Instance prefetcher is exhausted.");
+	reset(std::move(*model));
+}
+
+void EpisodeModel::reset_same_instance() {
+	m_model.free_transform();
+	m_model.reset_params();
+	m_model.set_params(instance_params);
+	prepare_model();
+}
+
+void EpisodeModel::use_presolved_problem() {
+	if ((presolve_cache() != nullptr) && (m_presolved_problem == nullptr)) {
+		m_presolved_problem = presolve_cache()->get_or_presolve(m_model);
+		// Without presolved problem, presolving ends the solve and the original problem is solved
+		if (m_presolved_problem != nullptr) {
+			m_model = m_presolved_problem->model().copy_orig();
+			m_model.set_params(scip_params());
+		}
+	}
+	if (m_presolved_problem != nullptr) m_model.disable_presolve();
+}
+
+void EpisodeModel::prepare_model() {
+	m_model.set_params(scip_params());
+	use_presolved_problem();
+	if (memory_budget() > 0) set_memory_limit(m_model, memory_budget());
+	if (root_basis_cache() != nullptr) m_model.enable_root_warm_start(root_basis_cache());
+}
+
+}  // namespace environment
+}  // namespace ecole
@@ -0,0 +1,34 @@
+#include <algorithm>
+
+#include <scip/scip.h>
+
+#include "ecole/environment/memory.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole {
+namespace environment {
+
+void set_memory_limit(scip::Model& model, std::size_t budget) {
+	auto constexpr bytes_per_megabyte = 1024. * 1024.;
+	auto const limit = static_cast<double>(budget) / bytes_per_megabyte;
+	model.set_param("limits/memory", std::min(model.get_param<double>("limits/memory"), limit));
+}
+
+bool exceeds_memory_budget(scip::Model const& model, std::size_t budget) {
+	auto const memory = model.memory_stats();
+	return memory.total + memory.external > budget;
+}
+
+DoneReason done_reason(scip::Model const& model, bool done, bool memory_exceeded) {
+	if (!done) return DoneReason::NotDone;
+	if (memory_exceeded) return DoneReason::MemoryLimit;
+	if (
+		(model.get_stage() >= SCIP_STAGE_PROBLEM) &&
+		(SCIPgetStatus(model.get_scip_ptr()) == SCIP_STATUS_MEMLIMIT)) {
+		return DoneReason::MemoryLimit;
+	}
+	return DoneReason::Finished;
+}
+
+}  // namespace environment
+}  // namespace ecole
@@ -0,0 +1,99 @@
+#include <utility>
+
+#include "ecole/instance/prefetcher.hpp"
+
+namespace ecole {
+namespace instance {
+
+InstancePrefetcher::InstancePrefetcher(
+	std::shared_ptr<InstanceSource> source_,
+	std::size_t n_ahead_,
+	std::size_t memory_budget_) :
+	source(std::move(source_)), n_ahead(n_ahead_ > 0 ? n_ahead_ : 1), memory_budget(memory_budget_) {
+	thread = std::thread{[this] { load_instances(); }};
+}
+
+InstancePrefetcher::~InstancePrefetcher() {
+	close();
+}
+
+nonstd::optional<scip::Model> InstancePrefetcher::next() {
+	auto lock = std::unique_lock<std::mutex>{mutex};
+	if (ready.empty() && !exhausted && !closed) {
+		auto const start = std::chrono::steady_clock::now();
+		ready_changed.wait(lock, [this] { return !ready.empty() || exhausted || closed; });
+		++m_stats.n_stalls;
+		m_stats.stall_time += std::chrono::steady_clock::now() - start;
+	}
+	if (ready.empty()) return {};
+
+	auto entry = std::move(ready.front());
+	ready.pop_front();
+	m_stats.ready_memory -= entry.memory;
+	ready_changed.notify_all();
+	if (entry.error) std::rethrow_exception(entry.error);
+	++m_stats.n_instances;
+	return std::move(entry.model);
+}
+
+void InstancePrefetcher::close() {
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		closed = true;
+		ready.clear();
+		m_stats.ready_memory = 0;
+	}
+	ready_changed.notify_all();
+	if (thread.joinable()) thread.join();
+}
+
+PrefetchStats InstancePrefetcher::stats() const {
+	std::lock_guard<std::mutex> lock{mutex};
+	auto stats = m_stats;
+	stats.n_ready = ready.size();
+	return stats;
+}
+
+bool InstancePrefetcher::has_room() const noexcept {
+	if (ready.empty()) return true;
+	if (ready.size() >= n_ahead) return false;
+	return (memory_budget == 0) || (m_stats.ready_memory < memory_budget);
+}
+
+void InstancePrefetcher::load_instances() {
+	while (true) {
+		{
+			auto lock = std::unique_lock<std::mutex>{mutex};
+			ready_changed.wait(lock, [this] { return closed || has_room(); });
+			if (closed) return;
+		}
+
+		// Load without holding the lock, so that ready instances can be taken meanwhile
+		auto entry = Entry{};
+		auto const start = std::chrono::steady_clock::now();
+		try {
+			entry.model = source->next();
+			if (entry.model) entry.memory = entry.model->memory_stats().total;
+		} catch (...) {
+			entry.error = std::current_exception();
+		}
+		auto const load_time = std::chrono::steady_clock::now() - start;
+
+		{
+			std::lock_guard<std::mutex> lock{mutex};
+			m_stats.load_time += load_time;
+			if (closed) return;
+			if (!entry.model && !entry.error) {
+				exhausted = true;
+			} else {
+				m_stats.ready_memory += entry.memory;
+				ready.push_back(std::move(entry));
+			}
+		}
+		ready_changed.notify_all();
+		if (exhausted) return;
+	}
+}
+
+}  // namespace instance
+}  // namespace ecole
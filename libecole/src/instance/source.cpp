@@ -0,0 +1,56 @@
+#include <stdexcept>
+#include <utility>
+
+#include <glob.h>
+
+#include "ecole/instance/source.hpp"
+
+namespace ecole {
+namespace instance {
+
+/*******************************
+ *  Definition of FileSource  *
+ *******************************/
+
+FileSource::FileSource(
+	std::vector<std::string> filenames,
+	bool cycle_,
+	scip::PluginProfile profile_) :
+	m_filenames(std::move(filenames)), cycle(cycle_), profile(profile_) {}
+
+FileSource
+FileSource::from_glob(std::string const& pattern, bool cycle, scip::PluginProfile profile) {
+	glob_t matches;
+	auto const status = ::glob(pattern.c_str(), 0, nullptr, &matches);
+	if (status != 0) {
+		globfree(&matches);
+		if (status == GLOB_NOMATCH) throw std::invalid_argument{"No file matches " + pattern};
+		throw std::runtime_error{"Could not expand " + pattern};
+	}
+	auto filenames = std::vector<std::string>{matches.gl_pathv, matches.gl_pathv + matches.gl_pathc};
+	globfree(&matches);
+	return {std::move(filenames), cycle, profile};
+}
+
+nonstd::optional<scip::Model> FileSource::next() {
+	if (m_filenames.empty()) return {};
+	if (index == m_filenames.size()) {
+		if (!cycle) return {};
+		index = 0;
+	}
+	return scip::Model::from_file(m_filenames[index++], profile);
+}
+
+/************************************
+ *  Definition of GeneratorSource  *
+ ************************************/
+
+GeneratorSource::GeneratorSource(Generator generator_) noexcept :
+	generator(std::move(generator_)) {}
+
+nonstd::optional<scip::Model> GeneratorSource::next() {
+	return generator();
+}
+
+}  // namespace instance
+}  // namespace ecole
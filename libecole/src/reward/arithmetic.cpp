@@ -0,0 +1,47 @@
+#include <utility>
+
+#include "ecole/reward/arithmetic.hpp"
+
+namespace ecole {
+namespace reward {
+
+UnaryArithmetic::UnaryArithmetic(Operation operation_, std::shared_ptr<RewardFunction> operand_) :
+	operation(operation_), operand(std::move(operand_)) {}
+
+void UnaryArithmetic::before_reset(scip::Model& model) {
+	operand->before_reset(model);
+}
+
+void UnaryArithmetic::reset(scip::Model const& model) {
+	operand->reset(model);
+}
+
+Reward UnaryArithmetic::obtain_reward(scip::Model const& model, bool done) {
+	return operation(operand->obtain_reward(model, done));
+}
+
+BinaryArithmetic::BinaryArithmetic(
+	Operation operation_,
+	std::shared_ptr<RewardFunction> left_,
+	std::shared_ptr<RewardFunction> right_) :
+	operation(operation_), left(std::move(left_)), right(std::move(right_)) {}
+
+void BinaryArithmetic::before_reset(scip::Model& model) {
+	left->before_reset(model);
+	right->before_reset(model);
+}
+
+void BinaryArithmetic::reset(scip::Model const& model) {
+	left->reset(model);
+	right->reset(model);
+}
+
+Reward BinaryArithmetic::obtain_reward(scip::Model const& model, bool done) {
+	// Evaluation order matters for stateful reward functions
+	auto const left_reward = left->obtain_reward(model, done);
+	auto const right_reward = right->obtain_reward(model, done);
+	return operation(left_reward, right_reward);
+}
+
+}  // namespace reward
+}  // namespace ecole
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <utility>
+
+#include <objscip/objeventhdlr.h>
+#include <scip/scip.h>
+
+#include "ecole/reward/primaldualintegral.hpp"
+#include "ecole/scip/model.hpp"
+
+#include "scip/utils.hpp"
+
+namespace ecole {
+namespace reward {
+
+struct PrimalDualIntegral::Integral {
+	/** Integral up to the last event. */
+	double area = 0.;
+	/** Gap from the last event, constant until the next one. */
+	double gap = 1.;
+	/** Solving time of the last event. */
+	double time = 0.;
+
+	/**
+	 * Add the integral up to the current solving time, and sample the current gap.
+	 */
+	void update(SCIP* scip) noexcept;
+};
+
+namespace {
+
+constexpr auto eventhdlr_name = "ecole::PrimalDualIntegral";
+/**
+ * Events on which the global bounds can change.
+ *
+ * The primal bound only changes with a new best solution.
+ * The dual bound only changes when the bound of an open node changes or when open nodes are
+ * removed, that is when an LP is solved, a node is solved (including branched or pruned), the
+ * next node is focused (after pruning of the queue), or a presolving round ends.
+ */
+constexpr auto event_types = SCIP_EVENTTYPE_BESTSOLFOUND | SCIP_EVENTTYPE_LPSOLVED |
+	SCIP_EVENTTYPE_NODESOLVED | SCIP_EVENTTYPE_NODEFOCUSED | SCIP_EVENTTYPE_PRESOLVEROUND;
+
+/**
+ * Primal-dual gap function, in [0, 1].
+ */
+double gap(SCIP* scip) noexcept {
+	auto const primal = SCIPgetPrimalbound(scip);
+	auto const dual = SCIPgetDualbound(scip);
+	if (SCIPisInfinity(scip, std::abs(primal)) || SCIPisInfinity(scip, std::abs(dual))) return 1.;
+	if (SCIPisEQ(scip, primal, dual)) return 0.;
+	if (primal * dual < 0) return 1.;
+	return std::abs(primal - dual) / std::max(std::abs(primal), std::abs(dual));
+}
+
+}  // namespace
+
+void PrimalDualIntegral::Integral::update(SCIP* scip) noexcept {
+	auto const now = SCIPgetSolvingTime(scip);
+	area += gap * (now - time);
+	time = now;
+	gap = reward::gap(scip);
+}
+
+namespace {
+
+/**
+ * Event handler updating the integral on bound changes.
+ *
+ * Events are caught from the transformation of the problem, so that the presolving time is
+ * accounted for.
+ */
+class IntegralEventhdlr : public ::scip::ObjEventhdlr {
+public:
+	using Integral = PrimalDualIntegral::Integral;
+
+	IntegralEventhdlr(SCIP* scip) :
+		ObjEventhdlr(scip, eventhdlr_name, "Update the primal-dual integral"),
+		integral(std::make_shared<Integral>()) {}
+
+	std::shared_ptr<Integral> const& get_integral() const noexcept { return integral; }
+
+	SCIP_RETCODE scip_init(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) override {
+		*integral = Integral{};
+		integral->time = SCIPgetSolvingTime(scip);
+		return SCIPcatchEvent(scip, event_types, eventhdlr, nullptr, nullptr);
+	}
+
+	SCIP_RETCODE scip_exit(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) override {
+		return SCIPdropEvent(scip, event_types, eventhdlr, nullptr, -1);
+	}
+
+	SCIP_RETCODE scip_exec(SCIP* scip, SCIP_EVENTHDLR*, SCIP_EVENT*, SCIP_EVENTDATA*) override {
+		integral->update(scip);
+		return SCIP_OKAY;
+	}
+
+private:
+	std::shared_ptr<Integral> integral;
+};
+
+}  // namespace
+
+void PrimalDualIntegral::before_reset(scip::Model& model) {
+	auto* const scip_ptr = model.get_scip_ptr();
+	// The event handler is already included if the model was used by another reward function
+	auto* eventhdlr =
+		dynamic_cast<IntegralEventhdlr*>(SCIPfindObjEventhdlr(scip_ptr, eventhdlr_name));
+	if (eventhdlr == nullptr) {
+		eventhdlr = new IntegralEventhdlr{scip_ptr};  // NOLINT
+		scip::call(SCIPincludeObjEventhdlr, scip_ptr, eventhdlr, true);
+	}
+	integral = eventhdlr->get_integral();
+}
+
+void PrimalDualIntegral::reset(scip::Model const& /* model */) {
+	last_integral = 0.;
+}
+
+Reward PrimalDualIntegral::obtain_reward(scip::Model const& model, bool /* done */) {
+	if (integral == nullptr) return 0.;
+	switch (model.get_stage()) {
+	// Only stages when the solving time is still running, states are also sampling points
+	case SCIP_STAGE_PRESOLVING:
+	case SCIP_STAGE_PRESOLVED:
+	case SCIP_STAGE_SOLVING:
+		integral->update(model.get_scip_ptr());
+		break;
+	default:
+		break;
+	}
+	auto const current_integral = integral->area;
+	auto const integral_diff = current_integral - last_integral;
+	last_integral = current_integral;
+	return -integral_diff;
+}
+
+}  // namespace reward
+}  // namespace ecole
@@ -0,0 +1,35 @@
+#include "ecole/reward/progress.hpp"
+
+#include "ecole/scip/model.hpp"
+
+namespace ecole {
+namespace reward {
+
+void Progress::reset(scip::Model const&) {
+	*this = Progress{};
+}
+
+auto Progress::obtain_rewards(scip::Model const& model, bool /* done */) -> Rewards {
+	auto const stats = model.stats();
+	auto rewards = Rewards{};
+
+	rewards.lp_iterations = static_cast<double>(-(stats.n_lp_iterations - last_lp_iter));
+	last_lp_iter = stats.n_lp_iterations;
+
+	rewards.n_nodes = static_cast<double>(-(stats.n_nodes - last_n_nodes));
+	last_n_nodes = stats.n_nodes;
+
+	if (stats.tree_size_estimate >= 0) {
+		rewards.tree_size = -(stats.tree_size_estimate - last_tree_size);
+		last_tree_size = stats.tree_size_estimate;
+	}
+
+	auto const time = model.solver_time().cpu;
+	rewards.solving_time = -std::chrono::duration<Reward>{time - last_time}.count();
+	last_time = time;
+
+	return rewards;
+}
+
+}  // namespace reward
+}  // namespace ecole
@@ -0,0 +1,26 @@
+#include <chrono>
+
+#include "ecole/reward/solvingtime.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace ecole {
+namespace reward {
+
+void SolvingTime::reset(scip::Model const& /* model */) {
+	last_time = std::chrono::nanoseconds{0};
+}
+
+Reward SolvingTime::obtain_reward(scip::Model const& model, bool /* done */) {
+	auto const time = solver_time(model);
+	auto const time_diff = std::chrono::duration<Reward>{time - last_time};
+	last_time = time;
+	return -time_diff.count();
+}
+
+std::chrono::nanoseconds SolvingTime::solver_time(scip::Model const& model) const noexcept {
+	auto const time = model.solver_time();
+	return wall ? time.wall : time.cpu;
+}
+
+}  // namespace reward
+}  // namespace ecole
@@ -0,0 +1,21 @@
+#include "ecole/reward/treesize.hpp"
+
+#include "ecole/scip/model.hpp"
+
+namespace ecole {
+namespace reward {
+
+void TreeSize::reset(scip::Model const&) {
+	last_tree_size = 0.;
+}
+
+Reward TreeSize::obtain_reward(scip::Model const& model, bool /* done */) {
+	auto const tree_size = model.tree_size_estimate();
+	if (tree_size < 0) return 0.;
+	auto tree_size_diff = tree_size - last_tree_size;
+	last_tree_size = tree_size;
+	return -tree_size_diff;
+}
+
+}  // namespace reward
+}  // namespace ecole
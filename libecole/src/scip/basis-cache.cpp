@@ -0,0 +1,49 @@
+#include <utility>
+
+#include "ecole/scip/basis-cache.hpp"
+
+namespace ecole {
+namespace scip {
+
+std::shared_ptr<LpBasis const> RootBasisCache::get(std::uint64_t fingerprint) const {
+	std::lock_guard<std::mutex> lock{mutex};
+	auto const iter = bases.find(fingerprint);
+	return iter == bases.end() ? nullptr : iter->second;
+}
+
+void RootBasisCache::insert(std::uint64_t fingerprint, LpBasis basis) {
+	auto basis_ptr = std::make_shared<LpBasis const>(std::move(basis));
+	std::lock_guard<std::mutex> lock{mutex};
+	bases.emplace(fingerprint, std::move(basis_ptr));
+}
+
+std::size_t RootBasisCache::size() const {
+	std::lock_guard<std::mutex> lock{mutex};
+	return bases.size();
+}
+
+void RootBasisCache::clear() {
+	std::lock_guard<std::mutex> lock{mutex};
+	bases.clear();
+	m_n_warm_starts = 0;
+	m_lp_iterations_saved = 0;
+}
+
+void RootBasisCache::record_warm_start(long_int lp_iterations_saved) noexcept {
+	std::lock_guard<std::mutex> lock{mutex};
+	++m_n_warm_starts;
+	m_lp_iterations_saved += lp_iterations_saved;
+}
+
+std::size_t RootBasisCache::n_warm_starts() const noexcept {
+	std::lock_guard<std::mutex> lock{mutex};
+	return m_n_warm_starts;
+}
+
+long_int RootBasisCache::lp_iterations_saved() const noexcept {
+	std::lock_guard<std::mutex> lock{mutex};
+	return m_lp_iterations_saved;
+}
+
+}  // namespace scip
+}  // namespace ecole
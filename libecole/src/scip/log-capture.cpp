@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include <objscip/objmessagehdlr.h>
+
+#include "scip/log-capture.hpp"
+#include "scip/utils.hpp"
+
+namespace ecole {
+namespace scip {
+
+/****************************
+ *  Definition of LogRing  *
+ ****************************/
+
+LogRing::LogRing(std::size_t capacity) :
+	m_capacity(std::max(capacity, std::size_t{1})),
+	buffer(std::make_unique<std::atomic<char>[]>(m_capacity)) {}
+
+void LogRing::write(char const* message) noexcept {
+	// Only one writer, the head can be read relaxed
+	auto const begin = head.load(std::memory_order_relaxed);
+	auto const end = begin + std::strlen(message);
+	// Readers must know what is about to be overwritten before it is
+	reserved.store(end, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	for (auto pos = begin; pos < end; ++pos, ++message) {
+		buffer[pos % m_capacity].store(*message, std::memory_order_relaxed);
+	}
+	head.store(end, std::memory_order_release);
+}
+
+std::string LogRing::tail(std::size_t max_size) const {
+	auto const end = head.load(std::memory_order_acquire);
+	auto const size = static_cast<std::uint64_t>(std::min(max_size, m_capacity));
+	auto const begin = end > size ? end - size : 0;
+	auto out = std::string(end - begin, '\0');
+	for (auto pos = begin; pos < end; ++pos) {
+		out[pos - begin] = buffer[pos % m_capacity].load(std::memory_order_relaxed);
+	}
+	// Characters overwritten by the writer during the copy are discarded
+	std::atomic_thread_fence(std::memory_order_acquire);
+	auto const new_end = reserved.load(std::memory_order_relaxed);
+	if (new_end > begin + m_capacity) {
+		auto const overwritten = std::min(new_end - m_capacity - begin, end - begin);
+		out.erase(0, overwritten);
+	}
+	return out;
+}
+
+/*************************************
+ *  Definition of message handlers  *
+ *************************************/
+
+namespace {
+
+class CaptureMessagehdlr : public ::scip::ObjMessagehdlr {
+public:
+	explicit CaptureMessagehdlr(std::shared_ptr<LogRing> ring_) :
+		ObjMessagehdlr(false), ring(std::move(ring_)) {}
+
+	void scip_error(SCIP_MESSAGEHDLR*, FILE*, char const* msg) override { ring->write(msg); }
+	void scip_warning(SCIP_MESSAGEHDLR*, FILE*, char const* msg) override { ring->write(msg); }
+	void scip_dialog(SCIP_MESSAGEHDLR*, FILE*, char const* msg) override { ring->write(msg); }
+	void scip_info(SCIP_MESSAGEHDLR*, FILE*, char const* msg) override { ring->write(msg); }
+
+private:
+	std::shared_ptr<LogRing> ring;
+};
+
+void set_messagehdlr(SCIP* scip, SCIP_MESSAGEHDLR* messagehdlr) {
+	// SCIP takes its own reference on the handler
+	auto const retcode = SCIPsetMessagehdlr(scip, messagehdlr);
+	SCIPmessagehdlrRelease(&messagehdlr);
+	if (retcode != SCIP_OKAY) throw Exception::from_retcode(retcode);
+}
+
+}  // namespace
+
+void set_capture_messagehdlr(SCIP* scip, std::shared_ptr<LogRing> ring) {
+	SCIP_MESSAGEHDLR* messagehdlr = nullptr;
+	scip::call(
+		SCIPcreateObjMessagehdlr,
+		&messagehdlr,
+		new CaptureMessagehdlr{std::move(ring)},  // NOLINT
+		true);
+	set_messagehdlr(scip, messagehdlr);
+}
+
+void set_quiet_messagehdlr(SCIP* scip) {
+	SCIP_MESSAGEHDLR* messagehdlr = nullptr;
+	scip::call(SCIPcreateMessagehdlrDefault, &messagehdlr, false, nullptr, true);
+	set_messagehdlr(scip, messagehdlr);
+}
+
+}  // namespace scip
+}  // namespace ecole
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <scip/scip.h>
+
+namespace ecole {
+namespace scip {
+
+/**
+ * A bounded ring buffer of characters, written by one thread and read by any.
+ *
+ * Writing never blocks nor allocates: old characters are overwritten when the buffer is full.
+ * Reading is lock-free and returns a consistent tail, discarding the characters that were
+ * overwritten while being read.
+ */
+class LogRing {
+public:
+	explicit LogRing(std::size_t capacity);
+
+	std::size_t capacity() const noexcept { return m_capacity; }
+
+	/**
+	 * Append a null terminated message (single writer).
+	 */
+	void write(char const* message) noexcept;
+
+	/**
+	 * Copy the last (at most) `max_size` characters written.
+	 */
+	std::string tail(std::size_t max_size) const;
+
+private:
+	std::size_t m_capacity;
+	std::unique_ptr<std::atomic<char>[]> buffer;
+	/** End of the characters completely written. */
+	std::atomic<std::uint64_t> head{0};
+	/** End of the characters being written, advanced before writing them. */
+	std::atomic<std::uint64_t> reserved{0};
+};
+
+/**
+ * Replace the message handler of a SCIP by one writing all output into the ring.
+ */
+void set_capture_messagehdlr(SCIP* scip, std::shared_ptr<LogRing> ring);
+
+/**
+ * Replace the message handler of a SCIP by a default quiet one.
+ */
+void set_quiet_messagehdlr(SCIP* scip);
+
+}  // namespace scip
+}  // namespace ecole
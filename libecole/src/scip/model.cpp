@@ -1,9 +1,17 @@
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
+#include <limits>
 #include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/syscall.h>
+#include <unistd.h>
 
 #include <fmt/format.h>
 #include <scip/scip.h>
@@ -14,12 +22,15 @@
 #include "ecole/scip/scimpl.hpp"
 
 #include "scip/utils.hpp"
+#include "scip/warm-start.hpp"
 
 namespace ecole {
 namespace scip {
 
 Model::Model() : scimpl(std::make_unique<Scimpl>()) {}
 
+Model::Model(PluginProfile profile) : scimpl(std::make_unique<Scimpl>(profile)) {}
+
 Model::Model(Model&&) noexcept = default;
 
 Model::Model(std::unique_ptr<Scimpl>&& other_scimpl) : scimpl(std::move(other_scimpl)) {}
@@ -32,6 +43,10 @@ SCIP* Model::get_scip_ptr() const noexcept {
 	return scimpl->get_scip_ptr();
 }
 
+PluginProfile Model::plugin_profile() const noexcept {
+	return scimpl->plugin_profile();
+}
+
 Model Model::copy_orig() const {
 	return std::make_unique<Scimpl>(scimpl->copy_orig());
 }
@@ -44,8 +59,8 @@ bool Model::operator!=(Model const& other) const noexcept {
 	return !(*this == other);
 }
 
-Model Model::from_file(const std::string& filename) {
-	auto model = Model{};
+Model Model::from_file(const std::string& filename, PluginProfile profile) {
+	auto model = Model{profile};
 	model.read_prob(filename);
 	return model;
 }
@@ -54,6 +69,91 @@ void Model::read_prob(std::string const& filename) {
 	scip::call(SCIPreadProb, get_scip_ptr(), filename.c_str(), nullptr);
 }
 
+namespace {
+
+/**
+ * An anonymous file holding a copy of a memory buffer.
+ *
+ * SCIP readers only accept a path, so the file is exposed through `/dev/fd`.
+ * On Linux the file lives in memory (`memfd_create`).
+ * Elsewhere, or on kernels older than 3.17, it falls back to an unlinked temporary file from
+ * `std::tmpfile`, which lives in the temporary directory and may be written to disk.
+ */
+class BufferFile {
+public:
+	explicit BufferFile(nonstd::span<char const> buffer) : fd(open_anonymous()) {
+		auto const* data = buffer.data();
+		auto remaining = buffer.size();
+		while (remaining > 0) {
+			auto const written = ::write(fd, data, remaining);
+			if (written < 0) {
+				::close(fd);
+				throw Exception("Could not write buffer to memory file");
+			}
+			data += written;
+			remaining -= static_cast<std::size_t>(written);
+		}
+		::lseek(fd, 0, SEEK_SET);
+	}
+	BufferFile(BufferFile const&) = delete;
+	BufferFile& operator=(BufferFile const&) = delete;
+	~BufferFile() { ::close(fd); }
+
+	std::string path() const { return fmt::format("/dev/fd/{}", fd); }
+
+private:
+	int fd;
+
+	static int open_anonymous() {
+#if defined(__linux__) && defined(SYS_memfd_create)
+		auto const memfd = static_cast<int>(::syscall(SYS_memfd_create, "ecole-buffer", 0U));
+		if (memfd >= 0) return memfd;
+#endif
+		// Fallback when memory files are not available, see the class documentation
+		auto* const tmp = std::tmpfile();
+		if (tmp == nullptr) throw Exception("Could not create memory file");
+		auto const tmpfd = ::dup(fileno(tmp));
+		std::fclose(tmp);
+		if (tmpfd < 0) throw Exception("Could not create memory file");
+		return tmpfd;
+	}
+};
+
+}  // namespace
+
+Model Model::from_buffer(
+	nonstd::span<char const> buffer,
+	std::string const& format,
+	PluginProfile profile) {
+	auto model = Model{profile};
+	model.read_prob_buffer(buffer, format);
+	return model;
+}
+
+void Model::read_prob_buffer(nonstd::span<char const> buffer, std::string const& format) {
+	auto const file = BufferFile{buffer};
+	scip::call(SCIPreadProb, get_scip_ptr(), file.path().c_str(), format.c_str());
+}
+
+std::vector<char> Model::write_orig_prob_buffer(std::string const& format, bool generic_names) const {
+	char* data = nullptr;
+	std::size_t size = 0;
+	auto* const file = open_memstream(&data, &size);
+	if (file == nullptr) throw Exception("Could not open memory stream");
+	try {
+		scip::call(SCIPprintOrigProblem, get_scip_ptr(), file, format.c_str(), generic_names);
+	} catch (...) {
+		std::fclose(file);
+		std::free(data);
+		throw;
+	}
+	// The stream buffer is only valid once the stream is closed, and then owned by us
+	std::fclose(file);
+	auto buffer = std::vector<char>(data, data + size);
+	std::free(data);
+	return buffer;
+}
+
 Stage Model::get_stage() const noexcept {
 	return SCIPgetStage(get_scip_ptr());
 }
@@ -155,8 +255,46 @@ std::map<std::string, Param> Model::get_params() const {
 	return params;
 }
 
+void Model::reset_params() {
+	scip::call(SCIPresetParams, get_scip_ptr());
+}
+
+std::map<std::string, Param> Model::get_non_default_params() const {
+	auto* const scip = get_scip_ptr();
+	auto* const* const scip_params = SCIPgetParams(scip);
+	auto const n_scip_params = SCIPgetNParams(scip);
+
+	std::map<std::string, Param> params{};
+	for (auto i = 0; i < n_scip_params; ++i) {
+		if (SCIPparamIsDefault(scip_params[i])) continue;
+		std::string name = SCIPparamGetName(scip_params[i]);
+		auto value = get_param<Param>(name);
+		params.emplace(std::move(name), std::move(value));
+	}
+	return params;
+}
+
+namespace {
+
+constexpr std::size_t exception_log_size = 2048;
+
+/**
+ * Run the function, adding the tail of the captured log to scip::Exception messages.
+ */
+template <typename Func> void with_log_tail(Model const& model, Func&& func) {
+	try {
+		func();
+	} catch (Exception const& e) {
+		auto const tail = model.log_tail(exception_log_size);
+		if (tail.empty()) throw;
+		throw Exception(fmt::format("{}\nSolver log tail:\n{}", e.what(), tail));
+	}
+}
+
+}  // namespace
+
 void Model::solve() {
-	scip::call(SCIPsolve, get_scip_ptr());
+	with_log_tail(*this, [this] { scimpl->solve(); });
 }
 
 bool Model::is_solved() const noexcept {
@@ -164,11 +302,11 @@ bool Model::is_solved() const noexcept {
 }
 
 void Model::solve_iter() {
-	scimpl->solve_iter();
+	with_log_tail(*this, [this] { scimpl->solve_iter(); });
 }
 
 void Model::solve_iter_branch(VarProxy var) {
-	scimpl->solve_iter_branch(var.value);
+	with_log_tail(*this, [this, var] { scimpl->solve_iter_branch(var.value); });
 }
 
 void Model::solve_iter_stop() {
@@ -179,6 +317,141 @@ bool Model::solve_iter_is_done() {
 	return scimpl->solve_iter_is_done();
 }
 
+void Model::free_transform() {
+	scimpl->free_transform();
+}
+
+utility::Durations Model::solver_time() const noexcept {
+	return scimpl->solver_time();
+}
+
+MemoryStats Model::memory_stats() const {
+	return scimpl->memory_stats();
+}
+
+SolverStats Model::stats() const {
+	auto* const scip_ptr = get_scip_ptr();
+	auto stats = SolverStats{};
+	stats.memory = memory_stats();
+	stats.primal_bound = SCIPinfinity(scip_ptr);
+	stats.dual_bound = -SCIPinfinity(scip_ptr);
+	stats.gap = SCIPinfinity(scip_ptr);
+
+	auto const stage = get_stage();
+	// Only stages when the following calls are authorized
+	if ((stage < SCIP_STAGE_PROBLEM) || (stage > SCIP_STAGE_SOLVED)) return stats;
+	stats.solving_time = SCIPgetSolvingTime(scip_ptr);
+
+	if (stage < SCIP_STAGE_TRANSFORMED) return stats;
+	stats.n_nodes = n_nodes();
+	stats.n_lp_iterations = n_lp_iterations();
+	stats.tree_size_estimate = tree_size_estimate();
+	stats.primal_bound = SCIPgetPrimalbound(scip_ptr);
+	stats.dual_bound = SCIPgetDualbound(scip_ptr);
+	stats.gap = SCIPgetGap(scip_ptr);
+	if (stage == SCIP_STAGE_SOLVING) stats.depth = SCIPgetDepth(scip_ptr);
+	return stats;
+}
+
+long_int Model::n_nodes() const noexcept {
+	auto const stage = get_stage();
+	// Only stages when the call is authorized
+	if ((stage < SCIP_STAGE_TRANSFORMED) || (stage > SCIP_STAGE_SOLVED)) return 0;
+	return SCIPgetNNodes(get_scip_ptr());
+}
+
+long_int Model::n_lp_iterations() const noexcept {
+	switch (get_stage()) {
+	case SCIP_STAGE_PRESOLVING:
+	case SCIP_STAGE_PRESOLVED:
+	case SCIP_STAGE_SOLVING:
+	case SCIP_STAGE_SOLVED:
+		return SCIPgetNLPIterations(get_scip_ptr());
+	default:
+		return 0;
+	}
+}
+
+real Model::tree_size_estimate() const noexcept {
+	switch (get_stage()) {
+	case SCIP_STAGE_SOLVING:
+		return SCIPgetTreesizeEstimation(get_scip_ptr());
+	case SCIP_STAGE_SOLVED:
+		// The tree search is complete
+		return static_cast<real>(SCIPgetNNodes(get_scip_ptr()));
+	default:
+		return -1.;
+	}
+}
+
+constexpr std::size_t Model::default_log_capacity;
+
+void Model::enable_log_capture(std::size_t capacity) {
+	scimpl->enable_log_capture(capacity);
+}
+
+void Model::disable_log_capture() {
+	scimpl->disable_log_capture();
+}
+
+std::string Model::log_tail(std::size_t max_size) const {
+	return scimpl->log_tail(max_size);
+}
+
+std::uint64_t Model::fingerprint() const {
+	auto* const scip_ptr = get_scip_ptr();
+	auto hash = Fnv1a{};
+	hash.add(SCIPgetObjsense(scip_ptr));
+	hash.add(SCIPgetOrigObjoffset(scip_ptr));
+
+	auto const n_vars = SCIPgetNOrigVars(scip_ptr);
+	auto* const* const vars = SCIPgetOrigVars(scip_ptr);
+	hash.add(n_vars);
+	for (int i = 0; i < n_vars; ++i) {
+		hash.add(SCIPvarGetName(vars[i]));
+		hash.add(SCIPvarGetLbOriginal(vars[i]));
+		hash.add(SCIPvarGetUbOriginal(vars[i]));
+		hash.add(SCIPvarGetObj(vars[i]));
+		hash.add(SCIPvarGetType(vars[i]));
+	}
+
+	auto const n_conss = SCIPgetNOrigConss(scip_ptr);
+	auto* const* const conss = SCIPgetOrigConss(scip_ptr);
+	hash.add(n_conss);
+	auto cons_vars = std::vector<SCIP_VAR*>{};
+	auto cons_vals = std::vector<SCIP_Real>{};
+	for (int i = 0; i < n_conss; ++i) {
+		hash.add(SCIPconsGetName(conss[i]));
+		hash.add(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[i])));
+		SCIP_Bool success = false;
+		auto const lhs = SCIPconsGetLhs(scip_ptr, conss[i], &success);
+		if (success) hash.add(lhs);
+		auto const rhs = SCIPconsGetRhs(scip_ptr, conss[i], &success);
+		if (success) hash.add(rhs);
+		int n_cons_vars = 0;
+		scip::call(SCIPgetConsNVars, scip_ptr, conss[i], &n_cons_vars, &success);
+		if (!success) continue;
+		cons_vars.resize(static_cast<std::size_t>(n_cons_vars));
+		cons_vals.resize(static_cast<std::size_t>(n_cons_vars));
+		scip::call(SCIPgetConsVars, scip_ptr, conss[i], cons_vars.data(), n_cons_vars, &success);
+		if (!success) continue;
+		scip::call(SCIPgetConsVals, scip_ptr, conss[i], cons_vals.data(), n_cons_vars, &success);
+		for (std::size_t j = 0; j < cons_vars.size(); ++j) {
+			hash.add(SCIPvarGetName(cons_vars[j]));
+			if (success) hash.add(cons_vals[j]);
+		}
+	}
+	return hash.value();
+}
+
+void Model::enable_root_warm_start(std::shared_ptr<RootBasisCache> cache) {
+	scip::enable_root_warm_start(get_scip_ptr(), std::move(cache), fingerprint());
+}
+
+long_int Model::root_lp_iterations_saved() const noexcept {
+	return scip::root_lp_iterations_saved(get_scip_ptr());
+}
+
 void Model::disable_presolve() {
 	scip::call(SCIPsetPresolving, get_scip_ptr(), SCIP_PARAMSETTING_OFF, true);
 }
@@ -216,6 +489,95 @@ RowView Model::lp_rows() const {
 	return RowView(scip_ptr, SCIPgetLPRows(scip_ptr), n_rows);
 }
 
+namespace {
+
+/**
+ * Convert SCIP infinite values to IEEE infinities.
+ */
+class InfinityConverter {
+public:
+	explicit InfinityConverter(SCIP* scip) noexcept : scip_infinity(SCIPinfinity(scip)) {}
+
+	real operator()(real value) const noexcept {
+		if (value >= scip_infinity) return std::numeric_limits<real>::infinity();
+		if (value <= -scip_infinity) return -std::numeric_limits<real>::infinity();
+		return value;
+	}
+
+private:
+	real scip_infinity;
+};
+
+template <typename Tensor> void resize(Tensor& tensor, std::size_t size) {
+	if (tensor.size() != size) tensor.resize({size});
+}
+
+}  // namespace
+
+ColArrays Model::lp_columns_arrays() const {
+	auto arrays = ColArrays{};
+	lp_columns_arrays(arrays);
+	return arrays;
+}
+
+void Model::lp_columns_arrays(ColArrays& arrays) const {
+	auto const scip_ptr = get_scip_ptr();
+	if (SCIPgetStage(scip_ptr) != SCIP_STAGE_SOLVING)
+		throw Exception("LP columns are only available during solving");
+	auto const n_cols = static_cast<std::size_t>(SCIPgetNLPCols(scip_ptr));
+	auto* const* const cols = SCIPgetLPCols(scip_ptr);
+
+	resize(arrays.lb, n_cols);
+	resize(arrays.ub, n_cols);
+	resize(arrays.obj, n_cols);
+	resize(arrays.prim_sol, n_cols);
+	resize(arrays.reduced_cost, n_cols);
+	resize(arrays.basis_status, n_cols);
+
+	auto const ieee = InfinityConverter{scip_ptr};
+	for (std::size_t i = 0; i < n_cols; ++i) {
+		auto* const col = cols[i];
+		arrays.lb[i] = ieee(SCIPcolGetLb(col));
+		arrays.ub[i] = ieee(SCIPcolGetUb(col));
+		arrays.obj[i] = SCIPcolGetObj(col);
+		arrays.prim_sol[i] = SCIPcolGetPrimsol(col);
+		arrays.reduced_cost[i] = SCIPgetColRedcost(scip_ptr, col);
+		arrays.basis_status[i] = SCIPcolGetBasisStatus(col);
+	}
+}
+
+RowArrays Model::lp_rows_arrays() const {
+	auto arrays = RowArrays{};
+	lp_rows_arrays(arrays);
+	return arrays;
+}
+
+void Model::lp_rows_arrays(RowArrays& arrays) const {
+	auto const scip_ptr = get_scip_ptr();
+	if (SCIPgetStage(scip_ptr) != SCIP_STAGE_SOLVING)
+		throw Exception("LP rows are only available during solving");
+	auto const n_rows = static_cast<std::size_t>(SCIPgetNLPRows(scip_ptr));
+	auto* const* const rows = SCIPgetLPRows(scip_ptr);
+
+	resize(arrays.lhs, n_rows);
+	resize(arrays.rhs, n_rows);
+	resize(arrays.l2_norm, n_rows);
+	resize(arrays.lp_activity, n_rows);
+	resize(arrays.dual_sol, n_rows);
+
+	auto const ieee = InfinityConverter{scip_ptr};
+	for (std::size_t i = 0; i < n_rows; ++i) {
+		auto* const row = rows[i];
+		auto const constant = SCIProwGetConstant(row);
+		// Infinite sides stay infinite when removing the constant
+		arrays.lhs[i] = ieee(SCIProwGetLhs(row)) - constant;
+		arrays.rhs[i] = ieee(SCIProwGetRhs(row)) - constant;
+		arrays.l2_norm[i] = SCIProwGetNorm(row);
+		arrays.lp_activity[i] = SCIPgetRowLPActivity(scip_ptr, row) - constant;
+		arrays.dual_sol[i] = SCIProwGetDualsol(row);
+	}
+}
+
 namespace internal {
 
 template <> std::string Caster<std::string, char>::cast(char val) {
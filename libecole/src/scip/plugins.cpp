@@ -0,0 +1,71 @@
+#include <cassert>
+#include <string>
+
+#include <fmt/format.h>
+#include <scip/scip.h>
+#include <scip/scipdefplugins.h>
+
+#include "ecole/scip/exception.hpp"
+#include "ecole/scip/plugins.hpp"
+
+#include "scip/utils.hpp"
+
+namespace ecole {
+namespace scip {
+
+PluginProfile plugin_profile_from_string(std::string const& name) {
+	if (name == "full") return PluginProfile::Full;
+	if (name == "minimal-branching") return PluginProfile::MinimalBranching;
+	throw Exception(fmt::format("Unknown plugin profile {}", name));
+}
+
+std::string to_string(PluginProfile profile) {
+	switch (profile) {
+	case PluginProfile::Full:
+		return "full";
+	case PluginProfile::MinimalBranching:
+		return "minimal-branching";
+	default:
+		assert(false);  // All enum value should be handled
+		return "";
+	}
+}
+
+static void include_minimal_branching_plugins(SCIP* scip) {
+	// Linear constraint handlers, linear must come first for the others to register upgrades
+	scip::call(SCIPincludeConshdlrIntegral, scip);
+	scip::call(SCIPincludeConshdlrLinear, scip);
+	scip::call(SCIPincludeConshdlrBounddisjunction, scip);
+	scip::call(SCIPincludeConshdlrKnapsack, scip);
+	scip::call(SCIPincludeConshdlrLogicor, scip);
+	scip::call(SCIPincludeConshdlrSetppc, scip);
+	scip::call(SCIPincludeConshdlrVarbound, scip);
+	// Readers
+	scip::call(SCIPincludeReaderCip, scip);
+	scip::call(SCIPincludeReaderLp, scip);
+	scip::call(SCIPincludeReaderMps, scip);
+	// Tree search
+	scip::call(SCIPincludeNodeselBfs, scip);
+	scip::call(SCIPincludeNodeselDfs, scip);
+	scip::call(SCIPincludeNodeselEstimate, scip);
+	scip::call(SCIPincludeBranchruleMostinf, scip);
+	scip::call(SCIPincludeBranchrulePscost, scip);
+	scip::call(SCIPincludeBranchruleRelpscost, scip);
+	// Cheap primal heuristics
+	scip::call(SCIPincludeHeurTrivial, scip);
+	scip::call(SCIPincludeHeurSimplerounding, scip);
+}
+
+void include_plugins(SCIP* scip, PluginProfile profile) {
+	switch (profile) {
+	case PluginProfile::Full:
+		return scip::call(SCIPincludeDefaultPlugins, scip);
+	case PluginProfile::MinimalBranching:
+		return include_minimal_branching_plugins(scip);
+	default:
+		assert(false);  // All enum value should be handled
+	}
+}
+
+}  // namespace scip
+}  // namespace ecole
@@ -0,0 +1,201 @@
+#include <array>
+#include <utility>
+
+#include <scip/scip.h>
+
+#include "ecole/scip/pool.hpp"
+
+#include "scip/log-capture.hpp"
+#include "scip/warm-start.hpp"
+
+namespace ecole {
+namespace scip {
+
+namespace {
+
+void free_scip(SCIP* scip) noexcept {
+	// Nothing sensible to do if freeing fails
+	SCIPfree(&scip);
+}
+
+/**
+ * Plugins and parameters added by Ecole to the SCIP of an episode.
+ *
+ * They do nothing outside of the episode that added them, and are found and reused rather than
+ * included again by later episodes.
+ */
+constexpr auto reverse_branchrule_name = "ecole::ReverseBranchrule";
+constexpr auto basis_installer_name = "ecole::RootBasisInstaller";
+constexpr auto basis_recorder_name = "ecole::RootBasisRecorder";
+constexpr auto integral_eventhdlr_name = "ecole::PrimalDualIntegral";
+constexpr auto warm_start_param_name = "ecole/rootwarmstart";
+
+int has(void const* plugin) noexcept {
+	return plugin != nullptr ? 1 : 0;
+}
+
+/**
+ * Number of plugins of every kind, and of parameters, in a SCIP, except the ones of Ecole.
+ *
+ * Plugins can be added to a SCIP, for instance by the dynamics, rewards or warm start of an
+ * episode, but never removed, so a SCIP has exactly the plugins of a profile (and possibly the
+ * ones of Ecole) if it has as many plugins and parameters as a new SCIP with this profile.
+ */
+std::array<int, 13> count_plugins(SCIP* scip) noexcept {
+	return {
+		SCIPgetNReaders(scip),
+		SCIPgetNPricers(scip),
+		SCIPgetNConshdlrs(scip),
+		SCIPgetNConflicthdlrs(scip),
+		SCIPgetNPresols(scip),
+		SCIPgetNRelaxs(scip) - has(SCIPfindRelax(scip, basis_installer_name)),
+		SCIPgetNSepas(scip),
+		SCIPgetNProps(scip),
+		SCIPgetNHeurs(scip),
+		SCIPgetNEventhdlrs(scip) - has(SCIPfindEventhdlr(scip, basis_recorder_name)) -
+			has(SCIPfindEventhdlr(scip, integral_eventhdlr_name)),
+		SCIPgetNNodesels(scip),
+		SCIPgetNBranchrules(scip) - has(SCIPfindBranchrule(scip, reverse_branchrule_name)),
+		SCIPgetNParams(scip) - has(SCIPgetParam(scip, warm_start_param_name)),
+	};
+}
+
+/**
+ * Bring back a SCIP object to its state after creation (except for the plugins).
+ *
+ * @return Whether the cleaning succeeded.
+ */
+bool clean(SCIP* scip) noexcept {
+	if ((SCIPgetStage(scip) != SCIP_STAGE_INIT) && (SCIPfreeProb(scip) != SCIP_OKAY)) return false;
+	if (SCIPresetParams(scip) != SCIP_OKAY) return false;
+	// Do not keep the basis cache of the last episode alive
+	release_root_warm_start(scip);
+	// Drop any log capture
+	if (!SCIPmessagehdlrIsQuiet(SCIPgetMessagehdlr(scip))) {
+		try {
+			set_quiet_messagehdlr(scip);
+		} catch (...) {
+			return false;
+		}
+	}
+	return SCIPgetStage(scip) == SCIP_STAGE_INIT;
+}
+
+}  // namespace
+
+ModelPool& ModelPool::global() {
+	static ModelPool pool{};
+	return pool;
+}
+
+ModelPool::ModelPool(std::size_t capacity) noexcept : m_capacity(capacity) {}
+
+ModelPool::~ModelPool() {
+	clear();
+}
+
+std::size_t ModelPool::capacity() const {
+	std::lock_guard<std::mutex> lock{mutex};
+	return m_capacity;
+}
+
+void ModelPool::set_capacity(std::size_t new_capacity) {
+	auto excess = std::vector<SCIP*>{};
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		m_capacity = new_capacity;
+		for (auto& profile_scips : scips) {
+			auto& pooled = profile_scips.second;
+			while (pooled.size() > m_capacity) {
+				excess.push_back(pooled.back());
+				pooled.pop_back();
+			}
+		}
+	}
+	for (auto* scip : excess) {
+		free_scip(scip);
+	}
+}
+
+std::size_t ModelPool::size() const {
+	std::lock_guard<std::mutex> lock{mutex};
+	auto total = std::size_t{0};
+	for (auto const& profile_scips : scips) {
+		total += profile_scips.second.size();
+	}
+	return total;
+}
+
+void ModelPool::clear() {
+	auto all = decltype(scips){};
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		std::swap(all, scips);
+	}
+	for (auto const& profile_scips : all) {
+		for (auto* scip : profile_scips.second) {
+			free_scip(scip);
+		}
+	}
+}
+
+SCIP* ModelPool::acquire(PluginProfile profile) {
+	std::lock_guard<std::mutex> lock{mutex};
+	auto& pooled = scips[profile];
+	if (pooled.empty()) return nullptr;
+	auto* const scip = pooled.back();
+	pooled.pop_back();
+	return scip;
+}
+
+bool ModelPool::has_profile_plugins(SCIP* scip, PluginProfile profile) noexcept {
+	try {
+		auto const counts = count_plugins(scip);
+		{
+			std::lock_guard<std::mutex> lock{mutex};
+			auto const iter = profile_counts.find(profile);
+			if (iter != profile_counts.end()) return iter->second == counts;
+		}
+		// Count the plugins of a new SCIP with the profile, without holding the lock
+		SCIP* reference = nullptr;
+		if (SCIPcreate(&reference) != SCIP_OKAY) return false;
+		auto reference_counts = decltype(counts){};
+		try {
+			include_plugins(reference, profile);
+			reference_counts = count_plugins(reference);
+		} catch (...) {
+			free_scip(reference);
+			return false;
+		}
+		free_scip(reference);
+		std::lock_guard<std::mutex> lock{mutex};
+		return profile_counts.emplace(profile, reference_counts).first->second == counts;
+	} catch (...) {
+		return false;
+	}
+}
+
+void ModelPool::release(SCIP* scip, PluginProfile profile) noexcept {
+	if (scip == nullptr) return;
+	auto const has_space = [this, profile] {
+		std::lock_guard<std::mutex> lock{mutex};
+		auto const iter = scips.find(profile);
+		return (iter == scips.end() ? 0 : iter->second.size()) < m_capacity;
+	};
+	// Checking and cleaning is done without holding the lock
+	if (has_space() && has_profile_plugins(scip, profile) && clean(scip)) {
+		std::lock_guard<std::mutex> lock{mutex};
+		try {
+			auto& pooled = scips[profile];
+			if (pooled.size() < m_capacity) {
+				pooled.push_back(scip);
+				return;
+			}
+		} catch (...) {
+		}
+	}
+	free_scip(scip);
+}
+
+}  // namespace scip
+}  // namespace ecole
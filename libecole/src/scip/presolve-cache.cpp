@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <scip/scip.h>
+
+#include "ecole/scip/exception.hpp"
+#include "ecole/scip/presolve-cache.hpp"
+
+#include "scip/utils.hpp"
+
+namespace ecole {
+namespace scip {
+
+namespace {
+
+/**
+ * Parameters that cannot change the result of presolving, left out of the cache key.
+ */
+constexpr char const* ignored_param_prefixes[] = {"randomization/", "display/", "visual/"};
+
+bool is_ignored_param(std::string const& name) noexcept {
+	auto const starts_name = [&name](char const* prefix) {
+		return name.compare(0, std::strlen(prefix), prefix) == 0;
+	};
+	return std::any_of(
+		std::begin(ignored_param_prefixes), std::end(ignored_param_prefixes), starts_name);
+}
+
+struct ParamHasher {
+	Fnv1a& hash;
+
+	void operator()(std::string const& value) const noexcept { hash.add(value.c_str()); }
+	template <typename T> void operator()(T value) const noexcept { hash.add(value); }
+};
+
+/**
+ * Express a transformed variable as an affine function of the active variables.
+ */
+AffineVar active_representation(SCIP* scip, SCIP_VAR* var, SCIP_HASHMAP* varmap) {
+	auto vars = std::vector<SCIP_VAR*>{};
+	auto scalars = std::vector<SCIP_Real>{};
+	auto n_vars = 0;
+	auto constant = SCIP_Real{0.};
+	auto required_size = 1;
+	// Start over with larger arrays until the representation fits
+	while (required_size > static_cast<int>(vars.size())) {
+		vars.assign(static_cast<std::size_t>(required_size), nullptr);
+		scalars.assign(static_cast<std::size_t>(required_size), 0.);
+		vars[0] = var;
+		scalars[0] = 1.;
+		n_vars = 1;
+		constant = 0.;
+		scip::call(
+			SCIPgetProbvarLinearSum,
+			scip,
+			vars.data(),
+			scalars.data(),
+			&n_vars,
+			required_size,
+			&constant,
+			&required_size,
+			true);
+	}
+
+	auto affine = AffineVar{};
+	affine.constant = constant;
+	for (auto i = 0; i < n_vars; ++i) {
+		auto* const copy = static_cast<SCIP_VAR*>(SCIPhashmapGetImage(varmap, vars[i]));
+		if (copy == nullptr) throw std::runtime_error{"Presolved variable was not copied"};
+		affine.terms.emplace_back(static_cast<std::size_t>(SCIPvarGetProbindex(copy)), scalars[i]);
+	}
+	return affine;
+}
+
+}  // namespace
+
+/*************************************
+ *  Definition of PresolvedProblem  *
+ *************************************/
+
+PresolvedProblem::PresolvedProblem(
+	Model model,
+	std::vector<AffineVar> original_vars,
+	std::chrono::nanoseconds presolve_time) noexcept :
+	m_model(std::move(model)),
+	m_original_vars(std::move(original_vars)),
+	m_presolve_time(presolve_time) {}
+
+PresolvedProblem PresolvedProblem::presolve(Model const& model) {
+	auto problem = try_presolve(model);
+	if (problem == nullptr) throw Exception{"Presolving ended the solve, there is no problem left"};
+	return std::move(*problem);
+}
+
+std::unique_ptr<PresolvedProblem> PresolvedProblem::try_presolve(Model const& model) {
+	auto source = model.copy_orig();
+	auto* const source_scip = source.get_scip_ptr();
+	auto const start = std::chrono::steady_clock::now();
+	scip::call(SCIPpresolve, source_scip);
+	auto const presolve_time = std::chrono::steady_clock::now() - start;
+	// Solved, infeasible, unbounded, or interrupted by a limit: the reduced problem says nothing
+	if (
+		(SCIPgetStage(source_scip) != SCIP_STAGE_PRESOLVED) ||
+		(SCIPgetStatus(source_scip) != SCIP_STATUS_UNKNOWN)) {
+		return nullptr;
+	}
+
+	// An empty SCIP with the same plugins, to copy the presolved problem as its original problem
+	auto presolved = model.copy_orig();
+	auto* const presolved_scip = presolved.get_scip_ptr();
+	scip::call(SCIPfreeProb, presolved_scip);
+	auto varmap = HashMap{presolved_scip, std::max(SCIPgetNVars(source_scip), 1)};
+	auto consmap = HashMap{presolved_scip, std::max(SCIPgetNConss(source_scip), 1)};
+	auto const* const name = SCIPgetProbName(source_scip);
+	scip::call(SCIPcopyProb, source_scip, presolved_scip, varmap.get(), consmap.get(), true, name);
+	scip::call(
+		SCIPcopyVars,
+		source_scip,
+		presolved_scip,
+		varmap.get(),
+		consmap.get(),
+		nullptr,
+		nullptr,
+		0,
+		true);
+	SCIP_Bool valid = false;
+	scip::call(
+		SCIPcopyConss, source_scip, presolved_scip, varmap.get(), consmap.get(), true, false, &valid);
+	if (!valid) throw std::runtime_error{"Presolved problem could not be copied"};
+
+	auto const n_orig_vars = SCIPgetNOrigVars(source_scip);
+	auto* const* const orig_vars = SCIPgetOrigVars(source_scip);
+	auto original_vars = std::vector<AffineVar>{};
+	original_vars.reserve(static_cast<std::size_t>(n_orig_vars));
+	for (auto i = 0; i < n_orig_vars; ++i) {
+		SCIP_VAR* trans_var = nullptr;
+		scip::call(SCIPgetTransformedVar, source_scip, orig_vars[i], &trans_var);
+		if (trans_var == nullptr) throw std::runtime_error{"Original variable was not transformed"};
+		auto affine = active_representation(source_scip, trans_var, varmap.get());
+		affine.name = SCIPvarGetName(orig_vars[i]);
+		original_vars.push_back(std::move(affine));
+	}
+	return std::unique_ptr<PresolvedProblem>{new PresolvedProblem{
+		std::move(presolved),
+		std::move(original_vars),
+		std::chrono::duration_cast<std::chrono::nanoseconds>(presolve_time)}};
+}
+
+std::vector<SCIP_Real> PresolvedProblem::to_original(nonstd::span<SCIP_Real const> values) const {
+	auto const n_presolved_vars = static_cast<std::size_t>(SCIPgetNOrigVars(m_model.get_scip_ptr()));
+	if (values.size() != n_presolved_vars) {
+		throw std::invalid_argument{"Expected one value per presolved variable"};
+	}
+	auto original_values = std::vector<SCIP_Real>{};
+	original_values.reserve(m_original_vars.size());
+	for (auto const& var : m_original_vars) {
+		auto value = var.constant;
+		for (auto const& term : var.terms) {
+			value += term.second * values[term.first];
+		}
+		original_values.push_back(value);
+	}
+	return original_values;
+}
+
+/**********************************
+ *  Definition of PresolveCache  *
+ **********************************/
+
+std::uint64_t PresolveCache::key(Model const& model) {
+	auto hash = Fnv1a{};
+	hash.add(model.fingerprint());
+	for (auto const& name_value : model.get_non_default_params()) {
+		if (is_ignored_param(name_value.first)) continue;
+		hash.add(name_value.first.c_str());
+		nonstd::visit(ParamHasher{hash}, name_value.second);
+	}
+	return hash.value();
+}
+
+std::shared_ptr<PresolvedProblem const> PresolveCache::get_or_presolve(Model const& model) {
+	auto const model_key = key(model);
+	{
+		std::lock_guard<std::mutex> lock{mutex};
+		auto const iter = problems.find(model_key);
+		if (iter != problems.end()) {
+			++m_n_hits;
+			if (iter->second != nullptr) m_time_saved += iter->second->presolve_time();
+			return iter->second;
+		}
+		++m_n_misses;
+	}
+	// Presolve without holding the lock, concurrent misses of the same key keep the first problem
+	auto problem = std::shared_ptr<PresolvedProblem const>{PresolvedProblem::try_presolve(model)};
+	std::lock_guard<std::mutex> lock{mutex};
+	return problems.emplace(model_key, std::move(problem)).first->second;
+}
+
+std::size_t PresolveCache::size() const {
+	std::lock_guard<std::mutex> lock{mutex};
+	return problems.size();
+}
+
+void PresolveCache::clear() {
+	std::lock_guard<std::mutex> lock{mutex};
+	problems.clear();
+	m_n_hits = 0;
+	m_n_misses = 0;
+	m_time_saved = std::chrono::nanoseconds{0};
+}
+
+std::size_t PresolveCache::n_hits() const noexcept {
+	std::lock_guard<std::mutex> lock{mutex};
+	return m_n_hits;
+}
+
+std::size_t PresolveCache::n_misses() const noexcept {
+	std::lock_guard<std::mutex> lock{mutex};
+	return m_n_misses;
+}
+
+std::chrono::nanoseconds PresolveCache::time_saved() const noexcept {
+	std::lock_guard<std::mutex> lock{mutex};
+	return m_time_saved;
+}
+
+}  // namespace scip
+}  // namespace ecole
@@ -1,11 +1,14 @@
+#include <algorithm>
 #include <mutex>
+#include <utility>
 
 #include <objscip/objbranchrule.h>
 #include <scip/scip.h>
-#include <scip/scipdefplugins.h>
 
+#include "ecole/scip/pool.hpp"
 #include "ecole/scip/scimpl.hpp"
 
+#include "scip/log-capture.hpp"
 #include "scip/utils.hpp"
 
 namespace ecole {
@@ -22,9 +25,12 @@ public:
 	static constexpr int max_priority = 536870911;
 	static constexpr int no_maxdepth = -1;
 	static constexpr double no_maxbounddist = 1.0;
+	static constexpr auto name = "ecole::ReverseBranchrule";
 
 	ReverseBranchrule(SCIP* scip, std::weak_ptr<utility::Controller::Executor>);
 
+	void set_executor(std::weak_ptr<utility::Controller::Executor> weak_executor_) noexcept;
+
 	auto
 	scip_execlp(SCIP* scip, SCIP_BRANCHRULE* branchrule, SCIP_Bool allowaddcons, SCIP_RESULT* result)
 		-> SCIP_RETCODE;
@@ -40,7 +46,11 @@ private:
  ****************************/
 
 void ScipDeleter::operator()(SCIP* ptr) {
-	scip::call(SCIPfree, &ptr);
+	if (recycle) {
+		ModelPool::global().release(ptr, profile);
+	} else {
+		scip::call(SCIPfree, &ptr);
+	}
 }
 
 static std::unique_ptr<SCIP, ScipDeleter> create_scip() {
@@ -52,13 +62,50 @@ static std::unique_ptr<SCIP, ScipDeleter> create_scip() {
 	return scip_ptr;
 }
 
-static std::unique_ptr<SCIP, ScipDeleter> copy_orig(SCIP const* const source) {
+/**
+ * Get a SCIP with the plugins of the profile, from the ModelPool if possible.
+ */
+static std::unique_ptr<SCIP, ScipDeleter> create_profile_scip(PluginProfile profile) {
+	if (auto* const pooled = ModelPool::global().acquire(profile)) {
+		return {pooled, ScipDeleter{true, profile}};
+	}
+	auto scip_ptr = create_scip();
+	include_plugins(scip_ptr.get(), profile);
+	scip_ptr.get_deleter() = ScipDeleter{true, profile};
+	return scip_ptr;
+}
+
+/**
+ * Copy the original problem and parameters in a SCIP that already has its plugins.
+ *
+ * @return Whether all constraints could be copied.
+ */
+static bool copy_orig_prob(SCIP* source, SCIP* dest) {
+	// Hash maps need a positive size, even for problems without variables or constraints
+	auto varmap = HashMap{dest, std::max(SCIPgetNOrigVars(source), 1)};
+	auto consmap = HashMap{dest, std::max(SCIPgetNOrigConss(source), 1)};
+	scip::call(SCIPcopyParamSettings, source, dest);
+	scip::call(SCIPcopyOrigProb, source, dest, varmap.get(), consmap.get(), SCIPgetProbName(source));
+	scip::call(SCIPcopyOrigVars, source, dest, varmap.get(), consmap.get(), nullptr, nullptr, 0);
+	SCIP_Bool valid = false;
+	scip::call(SCIPcopyOrigConss, source, dest, varmap.get(), consmap.get(), false, &valid);
+	return valid;
+}
+
+static std::unique_ptr<SCIP, ScipDeleter>
+copy_orig(SCIP const* const source, ScipDeleter const& source_deleter) {
 	if (!source) return nullptr;
 	if (SCIPgetStage(const_cast<SCIP*>(source)) == SCIP_STAGE_INIT) return create_scip();
-	auto dest = create_scip();
 	// Copy operation is not thread safe
 	static std::mutex m{};
 	std::lock_guard<std::mutex> g{m};
+	// Sources with the plugins of a profile are copied in a SCIP with the same plugins, possibly
+	// recycled
+	if (source_deleter.recycle) {
+		auto dest = create_profile_scip(source_deleter.profile);
+		if (copy_orig_prob(const_cast<SCIP*>(source), dest.get())) return dest;
+	}
+	auto dest = create_scip();
 	scip::call(
 		SCIPcopyOrig,
 		const_cast<SCIP*>(source),
@@ -73,9 +120,7 @@ static std::unique_ptr<SCIP, ScipDeleter> copy_orig(SCIP const* const source) {
 	return dest;
 }
 
-scip::Scimpl::Scimpl() : m_scip(create_scip()) {
-	scip::call(SCIPincludeDefaultPlugins, get_scip_ptr());
-}
+scip::Scimpl::Scimpl(PluginProfile profile) : m_scip(create_profile_scip(profile)) {}
 
 Scimpl::Scimpl(std::unique_ptr<SCIP, ScipDeleter>&& scip_ptr) noexcept :
 	m_scip(std::move(scip_ptr)) {}
@@ -84,23 +129,47 @@ SCIP* scip::Scimpl::get_scip_ptr() noexcept {
 	return m_scip.get();
 }
 
+PluginProfile Scimpl::plugin_profile() const noexcept {
+	return m_scip.get_deleter().profile;
+}
+
 scip::Scimpl scip::Scimpl::copy_orig() {
-	return ::ecole::scip::copy_orig(get_scip_ptr());
+	return ::ecole::scip::copy_orig(get_scip_ptr(), m_scip.get_deleter());
+}
+
+void Scimpl::solve() {
+	auto const timer = utility::ThreadTimer{};
+	try {
+		scip::call(SCIPsolve, get_scip_ptr());
+	} catch (...) {
+		past_solver_time += timer.elapsed();
+		throw;
+	}
+	past_solver_time += timer.elapsed();
 }
 
 void Scimpl::solve_iter() {
 	auto* const scip_ptr = get_scip_ptr();
+	stop_controller();
 	m_controller = std::make_unique<utility::Controller>(
 		[scip_ptr](std::weak_ptr<utility::Controller::Executor> weak_executor) {
-			scip::call(
-				SCIPincludeObjBranchrule,
-				scip_ptr,
-				new ReverseBranchrule(scip_ptr, weak_executor),  // NOLINT
-				true);
+			// The branchrule is already included if the SCIP was recycled or solved before
+			auto* const branchrule = dynamic_cast<ReverseBranchrule*>(
+				SCIPfindObjBranchrule(scip_ptr, ReverseBranchrule::name));
+			if (branchrule != nullptr) {
+				branchrule->set_executor(std::move(weak_executor));
+			} else {
+				scip::call(
+					SCIPincludeObjBranchrule,
+					scip_ptr,
+					new ReverseBranchrule(scip_ptr, std::move(weak_executor)),  // NOLINT
+					true);
+			}
 			scip::call(SCIPsolve, scip_ptr);  // NOLINT
 		});
 
 	m_controller->wait_thread();
+	sample_memory();
 }
 
 void scip::Scimpl::solve_iter_branch(SCIP_VAR* var) {
@@ -114,16 +183,71 @@ void scip::Scimpl::solve_iter_branch(SCIP_VAR* var) {
 		return SCIP_OKAY;
 	});
 	m_controller->wait_thread();
+	sample_memory();
 }
 
 void scip::Scimpl::solve_iter_stop() {
-	m_controller = nullptr;
+	stop_controller();
 }
 
 bool scip::Scimpl::solve_iter_is_done() {
 	return !(m_controller) || m_controller->is_done();
 }
 
+void Scimpl::free_transform() {
+	stop_controller();
+	auto* const scip_ptr = get_scip_ptr();
+	if (SCIPgetStage(scip_ptr) > SCIP_STAGE_PROBLEM) scip::call(SCIPfreeTransform, scip_ptr);
+	// Statistics restart as for a new model
+	past_solver_time = {};
+	peak_memory = 0;
+}
+
+MemoryStats Scimpl::memory_stats() {
+	sample_memory();
+	auto* const scip_ptr = get_scip_ptr();
+	auto stats = MemoryStats{};
+	stats.used = static_cast<std::size_t>(SCIPgetMemUsed(scip_ptr));
+	stats.total = static_cast<std::size_t>(SCIPgetMemTotal(scip_ptr));
+	stats.peak = peak_memory;
+	stats.external = static_cast<std::size_t>(SCIPgetMemExternEstim(scip_ptr));
+	return stats;
+}
+
+void Scimpl::enable_log_capture(std::size_t capacity) {
+	auto ring = std::make_shared<LogRing>(capacity);
+	set_capture_messagehdlr(get_scip_ptr(), ring);
+	log_ring = std::move(ring);
+}
+
+void Scimpl::disable_log_capture() {
+	if (log_ring == nullptr) return;
+	set_quiet_messagehdlr(get_scip_ptr());
+	log_ring = nullptr;
+}
+
+std::string Scimpl::log_tail(std::size_t max_size) const {
+	if (log_ring == nullptr) return {};
+	return log_ring->tail(max_size);
+}
+
+utility::Durations Scimpl::solver_time() const noexcept {
+	auto time = past_solver_time;
+	if (m_controller) time += m_controller->thread_time();
+	return time;
+}
+
+void Scimpl::stop_controller() noexcept {
+	if (m_controller) {
+		past_solver_time += m_controller->thread_time();
+		m_controller = nullptr;
+	}
+}
+
+void Scimpl::sample_memory() noexcept {
+	peak_memory = std::max(peak_memory, static_cast<std::size_t>(SCIPgetMemTotal(get_scip_ptr())));
+}
+
 /*************************************
  *  Definition of ReverseBranchrule  *
  *************************************/
@@ -135,13 +259,18 @@ scip::ReverseBranchrule::ReverseBranchrule(
 	std::weak_ptr<utility::Controller::Executor> weak_executor_) :
 	::scip::ObjBranchrule(
 		scip,
-		"ecole::ReverseBranchrule",
+		scip::ReverseBranchrule::name,
 		"Branchrule that wait for another thread to make the branching.",
 		scip::ReverseBranchrule::max_priority,
 		scip::ReverseBranchrule::no_maxdepth,
 		no_maxbounddist),
 	weak_executor(weak_executor_) {}
 
+void ReverseBranchrule::set_executor(
+	std::weak_ptr<utility::Controller::Executor> weak_executor_) noexcept {
+	weak_executor = std::move(weak_executor_);
+}
+
 auto ReverseBranchrule::scip_execlp(SCIP* scip, SCIP_BRANCHRULE*, SCIP_Bool, SCIP_RESULT* result)
 	-> SCIP_RETCODE {
 	if (weak_executor.expired()) {
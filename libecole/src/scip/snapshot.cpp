@@ -0,0 +1,441 @@
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+#include <scip/cons_linear.h>
+#include <scip/scip.h>
+
+#include "ecole/scip/exception.hpp"
+#include "ecole/scip/model.hpp"
+
+#include "scip/utils.hpp"
+
+namespace ecole {
+namespace scip {
+
+/*******************************************
+ *  Declaration of the snapshot file format  *
+ *******************************************/
+
+namespace {
+
+/**
+ * Fixed size header at the begining of every snapshot.
+ *
+ * Arrays follow the header in the order given by @ref Layout, each one starting on an 8 bytes
+ * boundary so that they can be used in place from a memory mapped file.
+ * Values are stored in the native byte order, which is checked when loading.
+ */
+struct Header {
+	std::array<char, 8> magic;
+	std::uint32_t version;
+	std::uint32_t byte_order;
+	std::int32_t obj_sense;
+	std::uint32_t padding;
+	double obj_offset;
+	std::uint64_t n_vars;
+	std::uint64_t n_conss;
+	std::uint64_t n_nonzeros;
+	std::uint64_t names_size;
+};
+static_assert(sizeof(Header) % 8 == 0, "Header must preserve array alignment");
+
+constexpr std::array<char, 8> snapshot_magic = {'E', 'C', 'O', 'L', 'E', 'S', 'N', 'P'};
+constexpr std::uint32_t snapshot_version = 1;
+constexpr std::uint32_t snapshot_byte_order = 0x01020304;
+
+/**
+ * Byte offsets of the arrays in a snapshot.
+ *
+ * The constraint matrix is stored in CSR format, rows being constraints.
+ * Names are null terminated and concatenated, the problem name first, then variables names,
+ * then constraints names.
+ */
+struct Layout {
+	std::size_t var_lb;
+	std::size_t var_ub;
+	std::size_t var_obj;
+	std::size_t cons_lhs;
+	std::size_t cons_rhs;
+	std::size_t values;
+	std::size_t row_begin;
+	std::size_t col_index;
+	std::size_t var_type;
+	std::size_t name_begin;
+	std::size_t names;
+	std::size_t total;
+
+	explicit Layout(Header const& header);
+
+	std::size_t n_names() const noexcept;
+
+private:
+	std::size_t n_names_;
+};
+
+}  // namespace
+
+/************************************************
+ *  Definition of Model snapshot read and write  *
+ ************************************************/
+
+namespace {
+
+template <typename T> T* array_at(char* data, std::size_t offset) {
+	return reinterpret_cast<T*>(data + offset);  // NOLINT
+}
+
+template <typename T> T const* array_at(char const* data, std::size_t offset) {
+	return reinterpret_cast<T const*>(data + offset);  // NOLINT
+}
+
+double to_ieee(SCIP* scip, SCIP_Real value) {
+	if (SCIPisInfinity(scip, value)) return std::numeric_limits<double>::infinity();
+	if (SCIPisInfinity(scip, -value)) return -std::numeric_limits<double>::infinity();
+	return value;
+}
+
+SCIP_Real from_ieee(SCIP* scip, double value) {
+	if (std::isinf(value)) return value > 0 ? SCIPinfinity(scip) : -SCIPinfinity(scip);
+	return value;
+}
+
+void validate(nonstd::span<char const> buffer, Header const& header, Layout const& layout) {
+	auto const* const data = buffer.data();
+	auto const n_vars = header.n_vars;
+	auto const n_conss = header.n_conss;
+
+	auto const* const row_begin = array_at<std::uint64_t>(data, layout.row_begin);
+	if ((row_begin[0] != 0) || (row_begin[n_conss] != header.n_nonzeros))
+		throw Exception("Invalid snapshot constraint matrix");
+	for (std::size_t i = 0; i < n_conss; ++i) {
+		if (row_begin[i] > row_begin[i + 1]) throw Exception("Invalid snapshot constraint matrix");
+	}
+	auto const* const col_index = array_at<std::uint32_t>(data, layout.col_index);
+	for (std::size_t k = 0; k < header.n_nonzeros; ++k) {
+		if (col_index[k] >= n_vars) throw Exception("Invalid snapshot constraint matrix");
+	}
+	auto const* const var_type = array_at<std::uint8_t>(data, layout.var_type);
+	for (std::size_t j = 0; j < n_vars; ++j) {
+		if (var_type[j] > SCIP_VARTYPE_CONTINUOUS) throw Exception("Invalid snapshot variable type");
+	}
+	// Every name must end with a null character inside the names array
+	auto const* const name_begin = array_at<std::uint64_t>(data, layout.name_begin);
+	auto const* const names = array_at<char>(data, layout.names);
+	if ((name_begin[0] != 0) || (name_begin[layout.n_names()] != header.names_size))
+		throw Exception("Invalid snapshot names");
+	for (std::size_t i = 0; i < layout.n_names(); ++i) {
+		auto const end = name_begin[i + 1];
+		if ((end <= name_begin[i]) || (names[end - 1] != '\0')) throw Exception("Invalid snapshot names");
+	}
+}
+
+}  // namespace
+
+Model Model::from_snapshot(nonstd::span<char const> buffer, PluginProfile profile) {
+	// Arrays are used in place, they must be aligned
+	if (reinterpret_cast<std::uintptr_t>(buffer.data()) % alignof(std::uint64_t) != 0) {
+		auto aligned = std::vector<std::uint64_t>((buffer.size() + 7) / 8);
+		std::memcpy(aligned.data(), buffer.data(), buffer.size());
+		return from_snapshot({reinterpret_cast<char const*>(aligned.data()), buffer.size()}, profile);
+	}
+
+	if (buffer.size() < sizeof(Header)) throw Exception("Invalid snapshot: too small");
+	auto header = Header{};
+	std::memcpy(&header, buffer.data(), sizeof(Header));
+	if (header.magic != snapshot_magic) throw Exception("Invalid snapshot: wrong magic number");
+	if (header.version != snapshot_version)
+		throw Exception(fmt::format("Unsupported snapshot version {}", header.version));
+	if (header.byte_order != snapshot_byte_order)
+		throw Exception("Snapshot was written with a different byte order");
+	// Guard against overflow when computing the layout
+	auto const size = buffer.size();
+	if (header.n_vars > size || header.n_conss > size || header.n_nonzeros > size ||
+			header.names_size > size)
+		throw Exception("Invalid snapshot: truncated");
+	auto const layout = Layout{header};
+	if (layout.total > size) throw Exception("Invalid snapshot: truncated");
+	validate(buffer, header, layout);
+
+	auto const* const data = buffer.data();
+	auto const n_vars = static_cast<std::size_t>(header.n_vars);
+	auto const n_conss = static_cast<std::size_t>(header.n_conss);
+	auto const* const var_lb = array_at<double>(data, layout.var_lb);
+	auto const* const var_ub = array_at<double>(data, layout.var_ub);
+	auto const* const var_obj = array_at<double>(data, layout.var_obj);
+	auto const* const var_type = array_at<std::uint8_t>(data, layout.var_type);
+	auto const* const cons_lhs = array_at<double>(data, layout.cons_lhs);
+	auto const* const cons_rhs = array_at<double>(data, layout.cons_rhs);
+	auto const* const values = array_at<double>(data, layout.values);
+	auto const* const row_begin = array_at<std::uint64_t>(data, layout.row_begin);
+	auto const* const col_index = array_at<std::uint32_t>(data, layout.col_index);
+	auto const* const name_begin = array_at<std::uint64_t>(data, layout.name_begin);
+	auto const* const names = array_at<char>(data, layout.names);
+
+	auto model = Model{profile};
+	auto* const scip = model.get_scip_ptr();
+
+	// Use the same flags as SCIP readers
+	auto const initial_conss = model.get_param<bool>("reading/initialconss");
+	auto const dynamic_conss = model.get_param<bool>("reading/dynamicconss");
+	auto const dynamic_cols = model.get_param<bool>("reading/dynamiccols");
+	auto const dynamic_rows = model.get_param<bool>("reading/dynamicrows");
+
+	scip::call(SCIPcreateProbBasic, scip, names + name_begin[0]);
+	scip::call(SCIPsetObjsense, scip, static_cast<SCIP_OBJSENSE>(header.obj_sense));
+	if (header.obj_offset != 0.) scip::call(SCIPaddOrigObjoffset, scip, header.obj_offset);
+
+	auto vars = std::vector<SCIP_VAR*>(n_vars, nullptr);
+	for (std::size_t j = 0; j < n_vars; ++j) {
+		SCIP_VAR* var = nullptr;
+		scip::call(
+			SCIPcreateVar,
+			scip,
+			&var,
+			names + name_begin[1 + j],
+			from_ieee(scip, var_lb[j]),
+			from_ieee(scip, var_ub[j]),
+			var_obj[j],
+			static_cast<SCIP_VARTYPE>(var_type[j]),
+			!dynamic_cols,
+			dynamic_cols,
+			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			nullptr);
+		scip::call(SCIPaddVar, scip, var);
+		// The problem holds its own reference to the variable
+		vars[j] = var;
+		scip::call(SCIPreleaseVar, scip, &var);
+	}
+
+	auto row_vars = std::vector<SCIP_VAR*>{};
+	for (std::size_t i = 0; i < n_conss; ++i) {
+		auto const begin = static_cast<std::size_t>(row_begin[i]);
+		auto const end = static_cast<std::size_t>(row_begin[i + 1]);
+		row_vars.resize(end - begin);
+		for (auto k = begin; k < end; ++k) {
+			row_vars[k - begin] = vars[col_index[k]];
+		}
+		SCIP_CONS* cons = nullptr;
+		scip::call(
+			SCIPcreateConsLinear,
+			scip,
+			&cons,
+			names + name_begin[1 + n_vars + i],
+			static_cast<int>(end - begin),
+			row_vars.data(),
+			// Values are copied by SCIP
+			const_cast<SCIP_Real*>(values + begin),  // NOLINT
+			from_ieee(scip, cons_lhs[i]),
+			from_ieee(scip, cons_rhs[i]),
+			initial_conss && !dynamic_rows,
+			true,
+			true,
+			true,
+			true,
+			false,
+			false,
+			dynamic_conss,
+			dynamic_rows,
+			false);
+		scip::call(SCIPaddCons, scip, cons);
+		scip::call(SCIPreleaseCons, scip, &cons);
+	}
+
+	return model;
+}
+
+namespace {
+
+/**
+ * Read only memory mapping of a whole file.
+ */
+class MappedFile {
+public:
+	explicit MappedFile(std::string const& filename) {
+		auto const fd = ::open(filename.c_str(), O_RDONLY);
+		if (fd < 0) throw Exception(fmt::format("Could not open file {}", filename));
+		struct stat info {};
+		if (::fstat(fd, &info) != 0) {
+			::close(fd);
+			throw Exception(fmt::format("Could not read file {}", filename));
+		}
+		size = static_cast<std::size_t>(info.st_size);
+		if (size > 0) data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (data == MAP_FAILED) throw Exception(fmt::format("Could not map file {}", filename));
+	}
+	MappedFile(MappedFile const&) = delete;
+	MappedFile& operator=(MappedFile const&) = delete;
+	~MappedFile() {
+		if (data != nullptr) ::munmap(data, size);
+	}
+
+	nonstd::span<char const> span() const noexcept { return {static_cast<char const*>(data), size}; }
+
+private:
+	void* data = nullptr;
+	std::size_t size = 0;
+};
+
+}  // namespace
+
+Model Model::from_snapshot_file(std::string const& filename) {
+	auto const file = MappedFile{filename};
+	return from_snapshot(file.span());
+}
+
+std::vector<char> Model::write_snapshot() const {
+	auto* const scip = get_scip_ptr();
+	if (get_stage() == SCIP_STAGE_INIT) throw Exception("Cannot snapshot a model without problem");
+
+	auto const n_vars = static_cast<std::size_t>(SCIPgetNOrigVars(scip));
+	auto* const* const vars = SCIPgetOrigVars(scip);
+	auto const n_conss = static_cast<std::size_t>(SCIPgetNOrigConss(scip));
+	auto* const* const conss = SCIPgetOrigConss(scip);
+
+	auto header = Header{};
+	header.magic = snapshot_magic;
+	header.version = snapshot_version;
+	header.byte_order = snapshot_byte_order;
+	header.obj_sense = static_cast<std::int32_t>(SCIPgetObjsense(scip));
+	header.obj_offset = SCIPgetOrigObjoffset(scip);
+	header.n_vars = n_vars;
+	header.n_conss = n_conss;
+	header.names_size = std::strlen(SCIPgetProbName(scip)) + 1;
+	for (std::size_t j = 0; j < n_vars; ++j) {
+		header.names_size += std::strlen(SCIPvarGetName(vars[j])) + 1;
+	}
+	for (std::size_t i = 0; i < n_conss; ++i) {
+		auto const* const handler_name = SCIPconshdlrGetName(SCIPconsGetHdlr(conss[i]));
+		if (std::strcmp(handler_name, "linear") != 0)
+			throw Exception(fmt::format(
+				"Snapshots only support linear constraints, constraint <{}> is of type {}",
+				SCIPconsGetName(conss[i]),
+				handler_name));
+		header.n_nonzeros += static_cast<std::uint64_t>(SCIPgetNVarsLinear(scip, conss[i]));
+		header.names_size += std::strlen(SCIPconsGetName(conss[i])) + 1;
+	}
+
+	auto const layout = Layout{header};
+	auto buffer = std::vector<char>(layout.total, 0);
+	auto* const data = buffer.data();
+	std::memcpy(data, &header, sizeof(Header));
+
+	auto* const name_begin = array_at<std::uint64_t>(data, layout.name_begin);
+	auto* const names = array_at<char>(data, layout.names);
+	std::size_t name_idx = 0;
+	auto add_name = [&name_idx, name_begin, names](char const* name) {
+		auto const size = std::strlen(name) + 1;
+		std::memcpy(names + name_begin[name_idx], name, size);
+		name_begin[name_idx + 1] = name_begin[name_idx] + size;
+		++name_idx;
+	};
+	name_begin[0] = 0;
+	add_name(SCIPgetProbName(scip));
+
+	auto* const var_lb = array_at<double>(data, layout.var_lb);
+	auto* const var_ub = array_at<double>(data, layout.var_ub);
+	auto* const var_obj = array_at<double>(data, layout.var_obj);
+	auto* const var_type = array_at<std::uint8_t>(data, layout.var_type);
+	for (std::size_t j = 0; j < n_vars; ++j) {
+		auto* const var = vars[j];
+		assert(SCIPvarGetProbindex(var) == static_cast<int>(j));
+		var_lb[j] = to_ieee(scip, SCIPvarGetLbOriginal(var));
+		var_ub[j] = to_ieee(scip, SCIPvarGetUbOriginal(var));
+		var_obj[j] = SCIPvarGetObj(var);
+		var_type[j] = static_cast<std::uint8_t>(SCIPvarGetType(var));
+		add_name(SCIPvarGetName(var));
+	}
+
+	auto* const cons_lhs = array_at<double>(data, layout.cons_lhs);
+	auto* const cons_rhs = array_at<double>(data, layout.cons_rhs);
+	auto* const values = array_at<double>(data, layout.values);
+	auto* const row_begin = array_at<std::uint64_t>(data, layout.row_begin);
+	auto* const col_index = array_at<std::uint32_t>(data, layout.col_index);
+	row_begin[0] = 0;
+	for (std::size_t i = 0; i < n_conss; ++i) {
+		auto* const cons = conss[i];
+		auto const row_nnz = static_cast<std::size_t>(SCIPgetNVarsLinear(scip, cons));
+		auto* const* const row_vars = SCIPgetVarsLinear(scip, cons);
+		auto const* const row_vals = SCIPgetValsLinear(scip, cons);
+		auto const begin = static_cast<std::size_t>(row_begin[i]);
+		for (std::size_t k = 0; k < row_nnz; ++k) {
+			col_index[begin + k] = static_cast<std::uint32_t>(SCIPvarGetProbindex(row_vars[k]));
+			values[begin + k] = row_vals[k];
+		}
+		row_begin[i + 1] = begin + row_nnz;
+		cons_lhs[i] = to_ieee(scip, SCIPgetLhsLinear(scip, cons));
+		cons_rhs[i] = to_ieee(scip, SCIPgetRhsLinear(scip, cons));
+		add_name(SCIPconsGetName(cons));
+	}
+
+	return buffer;
+}
+
+void Model::write_snapshot_file(std::string const& filename) const {
+	auto const buffer = write_snapshot();
+	auto file = std::ofstream{filename, std::ios::binary | std::ios::trunc};
+	file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	if (!file) throw Exception(fmt::format("Could not write file {}", filename));
+}
+
+/****************************
+ *  Definition of Layout  *
+ ****************************/
+
+namespace {
+
+std::size_t aligned(std::size_t n_bytes) noexcept {
+	return (n_bytes + 7) & ~std::size_t{7};
+}
+
+Layout::Layout(Header const& header) {
+	auto const n_vars = static_cast<std::size_t>(header.n_vars);
+	auto const n_conss = static_cast<std::size_t>(header.n_conss);
+	auto const n_nonzeros = static_cast<std::size_t>(header.n_nonzeros);
+	n_names_ = 1 + n_vars + n_conss;
+
+	auto offset = sizeof(Header);
+	auto next = [&offset](std::size_t n_bytes) {
+		auto const begin = offset;
+		offset += aligned(n_bytes);
+		return begin;
+	};
+	var_lb = next(n_vars * sizeof(double));
+	var_ub = next(n_vars * sizeof(double));
+	var_obj = next(n_vars * sizeof(double));
+	cons_lhs = next(n_conss * sizeof(double));
+	cons_rhs = next(n_conss * sizeof(double));
+	values = next(n_nonzeros * sizeof(double));
+	row_begin = next((n_conss + 1) * sizeof(std::uint64_t));
+	col_index = next(n_nonzeros * sizeof(std::uint32_t));
+	var_type = next(n_vars * sizeof(std::uint8_t));
+	name_begin = next((n_names_ + 1) * sizeof(std::uint64_t));
+	names = next(static_cast<std::size_t>(header.names_size));
+	total = offset;
+}
+
+std::size_t Layout::n_names() const noexcept {
+	return n_names_;
+}
+
+}  // namespace
+
+}  // namespace scip
+}  // namespace ecole
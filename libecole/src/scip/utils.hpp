@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
 #include <scip/scip.h>
 
 #include "ecole/scip/exception.hpp"
@@ -13,5 +17,42 @@ template <typename Func, typename... Arguments> inline void call(Func func, Argu
 	if (retcode != SCIP_OKAY) throw scip::Exception::from_retcode(retcode);
 }
 
+/**
+ * Owning wrapper around a SCIP_HASHMAP.
+ */
+class HashMap {
+public:
+	HashMap(SCIP* scip, int size) { scip::call(SCIPhashmapCreate, &ptr, SCIPblkmem(scip), size); }
+	HashMap(HashMap const&) = delete;
+	HashMap& operator=(HashMap const&) = delete;
+	~HashMap() { SCIPhashmapFree(&ptr); }
+
+	SCIP_HASHMAP* get() noexcept { return ptr; }
+
+private:
+	SCIP_HASHMAP* ptr = nullptr;
+};
+
+/**
+ * 64 bits FNV-1a hash.
+ */
+class Fnv1a {
+public:
+	void add(void const* data, std::size_t size) noexcept {
+		auto const* const bytes = static_cast<unsigned char const*>(data);
+		for (std::size_t i = 0; i < size; ++i) {
+			hash = (hash ^ bytes[i]) * prime;
+		}
+	}
+	void add(char const* str) noexcept { add(str, std::strlen(str) + 1); }
+	template <typename T> void add(T value) noexcept { add(&value, sizeof(value)); }
+
+	std::uint64_t value() const noexcept { return hash; }
+
+private:
+	static constexpr std::uint64_t prime = 0x100000001b3ULL;
+	std::uint64_t hash = 0xcbf29ce484222325ULL;
+};
+
 }  // namespace scip
 }  // namespace ecole
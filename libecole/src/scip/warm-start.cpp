@@ -0,0 +1,212 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <lpi/lpi.h>
+#include <objscip/objeventhdlr.h>
+#include <objscip/objrelax.h>
+#include <scip/scip.h>
+
+#include "scip/utils.hpp"
+#include "scip/warm-start.hpp"
+
+namespace ecole {
+namespace scip {
+
+namespace {
+
+constexpr auto enable_param = "ecole/rootwarmstart";
+constexpr auto installer_name = "ecole::RootBasisInstaller";
+constexpr auto recorder_name = "ecole::RootBasisRecorder";
+
+/**
+ * State shared by the two warm start plugins of a SCIP.
+ */
+struct WarmStartState {
+	std::shared_ptr<RootBasisCache> cache;
+	std::uint64_t fingerprint = 0;
+	/** The cached basis installed in the current solve, if any. */
+	std::shared_ptr<LpBasis const> installed;
+	bool tried = false;
+	/** Root LP iterations saved in the current solve, compared to the cold solve. */
+	long_int lp_iterations_saved = 0;
+};
+
+bool is_enabled(SCIP* scip) {
+	SCIP_Bool enabled = false;
+	return (SCIPgetBoolParam(scip, enable_param, &enabled) == SCIP_OKAY) && enabled;
+}
+
+/**
+ * Relaxator run before the root LP to install the cached basis in the LP solver.
+ *
+ * Relaxators with non negative priority are called before the LP is solved, which is the only
+ * place where the LP can be constructed and flushed without being solved.
+ * Once flushed, SCIP does not reload the LP solver before solving the unchanged LP, so the basis
+ * only changes the starting point of the simplex and none of the LP data known to SCIP.
+ * The basis is therefore only installed when the LP solver holds exactly the flushed LP.
+ */
+class RootBasisInstaller : public ::scip::ObjRelax {
+public:
+	RootBasisInstaller(SCIP* scip, std::shared_ptr<WarmStartState> state_) :
+		ObjRelax(scip, installer_name, "Install cached root LP basis", 0, 1),
+		state(std::move(state_)) {}
+
+	void configure(std::shared_ptr<RootBasisCache> cache, std::uint64_t fingerprint) {
+		state->cache = std::move(cache);
+		state->fingerprint = fingerprint;
+	}
+
+	long_int lp_iterations_saved() const noexcept { return state->lp_iterations_saved; }
+
+	SCIP_RETCODE scip_initsol(SCIP* /*scip*/, SCIP_RELAX* /*relax*/) override {
+		state->installed = nullptr;
+		state->tried = false;
+		state->lp_iterations_saved = 0;
+		return SCIP_OKAY;
+	}
+
+	SCIP_RETCODE scip_exec(
+		SCIP* scip,
+		SCIP_RELAX* /*relax*/,
+		SCIP_Real* /*lowerbound*/,
+		SCIP_RESULT* result) override {
+		*result = SCIP_DIDNOTRUN;
+		if (state->tried || !is_enabled(scip) || (SCIPgetDepth(scip) != 0)) return SCIP_OKAY;
+		state->tried = true;
+
+		auto basis = state->cache->get(state->fingerprint);
+		if (basis == nullptr) return SCIP_OKAY;
+
+		SCIP_Bool cutoff = false;
+		SCIP_CALL(SCIPconstructLP(scip, &cutoff));
+		if (cutoff) return SCIP_OKAY;
+		SCIP_CALL(SCIPflushLP(scip));
+		if (!SCIPisLPConstructed(scip) || (SCIPgetLPSolstat(scip) != SCIP_LPSOLSTAT_NOTSOLVED)) {
+			return SCIP_OKAY;
+		}
+
+		// Map the basis through names, giving up if the LP is not the one cached
+		auto const n_cols = SCIPgetNLPCols(scip);
+		auto* const* const cols = SCIPgetLPCols(scip);
+		auto cstat = std::vector<int>(static_cast<std::size_t>(n_cols));
+		for (int i = 0; i < n_cols; ++i) {
+			auto const iter = basis->columns.find(SCIPvarGetName(SCIPcolGetVar(cols[i])));
+			if (iter == basis->columns.end()) return SCIP_OKAY;
+			cstat[static_cast<std::size_t>(SCIPcolGetLPPos(cols[i]))] = iter->second;
+		}
+		auto const n_rows = SCIPgetNLPRows(scip);
+		auto* const* const rows = SCIPgetLPRows(scip);
+		auto rstat = std::vector<int>(static_cast<std::size_t>(n_rows));
+		for (int i = 0; i < n_rows; ++i) {
+			auto const iter = basis->rows.find(SCIProwGetName(rows[i]));
+			if (iter == basis->rows.end()) return SCIP_OKAY;
+			rstat[static_cast<std::size_t>(SCIProwGetLPPos(rows[i]))] = iter->second;
+		}
+
+		SCIP_LPI* lpi = nullptr;
+		SCIP_CALL(SCIPgetLPI(scip, &lpi));
+		int n_lpi_cols = 0;
+		int n_lpi_rows = 0;
+		SCIP_CALL(SCIPlpiGetNCols(lpi, &n_lpi_cols));
+		SCIP_CALL(SCIPlpiGetNRows(lpi, &n_lpi_rows));
+		if ((n_lpi_cols != n_cols) || (n_lpi_rows != n_rows)) return SCIP_OKAY;
+		// A basis rejected by the LP solver leaves it with its own starting point
+		if (SCIPlpiSetBase(lpi, cstat.data(), rstat.data()) != SCIP_OKAY) return SCIP_OKAY;
+		state->installed = std::move(basis);
+		return SCIP_OKAY;
+	}
+
+private:
+	std::shared_ptr<WarmStartState> state;
+};
+
+/**
+ * Event handler recording the basis of the first root LP solved.
+ */
+class RootBasisRecorder : public ::scip::ObjEventhdlr {
+public:
+	RootBasisRecorder(SCIP* scip, std::shared_ptr<WarmStartState> state_) :
+		ObjEventhdlr(scip, recorder_name, "Record root LP basis"), state(std::move(state_)) {}
+
+	SCIP_RETCODE scip_initsol(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) override {
+		return SCIPcatchEvent(scip, SCIP_EVENTTYPE_FIRSTLPSOLVED, eventhdlr, nullptr, nullptr);
+	}
+
+	SCIP_RETCODE scip_exitsol(SCIP* scip, SCIP_EVENTHDLR* eventhdlr) override {
+		return SCIPdropEvent(scip, SCIP_EVENTTYPE_FIRSTLPSOLVED, eventhdlr, nullptr, -1);
+	}
+
+	SCIP_RETCODE scip_exec(SCIP* scip, SCIP_EVENTHDLR*, SCIP_EVENT*, SCIP_EVENTDATA*) override {
+		if (!is_enabled(scip) || (SCIPgetDepth(scip) != 0)) return SCIP_OKAY;
+		if ((SCIPgetLPSolstat(scip) != SCIP_LPSOLSTAT_OPTIMAL) || !SCIPisLPSolBasic(scip)) {
+			return SCIP_OKAY;
+		}
+		auto const lp_iterations = SCIPgetNLPIterations(scip);
+		if (state->installed != nullptr) {
+			state->lp_iterations_saved = state->installed->lp_iterations - lp_iterations;
+			state->cache->record_warm_start(state->lp_iterations_saved);
+			return SCIP_OKAY;
+		}
+
+		auto basis = LpBasis{};
+		basis.lp_iterations = lp_iterations;
+		auto const n_cols = SCIPgetNLPCols(scip);
+		auto* const* const cols = SCIPgetLPCols(scip);
+		for (int i = 0; i < n_cols; ++i) {
+			basis.columns.emplace(SCIPvarGetName(SCIPcolGetVar(cols[i])), SCIPcolGetBasisStatus(cols[i]));
+		}
+		auto const n_rows = SCIPgetNLPRows(scip);
+		auto* const* const rows = SCIPgetLPRows(scip);
+		for (int i = 0; i < n_rows; ++i) {
+			basis.rows.emplace(SCIProwGetName(rows[i]), SCIProwGetBasisStatus(rows[i]));
+		}
+		state->cache->insert(state->fingerprint, std::move(basis));
+		return SCIP_OKAY;
+	}
+
+private:
+	std::shared_ptr<WarmStartState> state;
+};
+
+}  // namespace
+
+void enable_root_warm_start(
+	SCIP* scip,
+	std::shared_ptr<RootBasisCache> cache,
+	std::uint64_t fingerprint) {
+	auto* installer = dynamic_cast<RootBasisInstaller*>(SCIPfindObjRelax(scip, installer_name));
+	if (installer == nullptr) {
+		auto state = std::make_shared<WarmStartState>();
+		installer = new RootBasisInstaller{scip, state};  // NOLINT
+		scip::call(SCIPincludeObjRelax, scip, installer, true);
+		scip::call(SCIPincludeObjEventhdlr, scip, new RootBasisRecorder{scip, state}, true);  // NOLINT
+		scip::call(
+			SCIPaddBoolParam,
+			scip,
+			enable_param,
+			"Whether to warm start the root LP from a basis cache (set by Ecole)",
+			nullptr,
+			false,
+			false,
+			nullptr,
+			nullptr);
+	}
+	installer->configure(std::move(cache), fingerprint);
+	scip::call(SCIPsetBoolParam, scip, enable_param, true);
+}
+
+void release_root_warm_start(SCIP* scip) noexcept {
+	auto* const installer = dynamic_cast<RootBasisInstaller*>(SCIPfindObjRelax(scip, installer_name));
+	if (installer != nullptr) installer->configure(nullptr, 0);
+	SCIPsetBoolParam(scip, enable_param, false);
+}
+
+long_int root_lp_iterations_saved(SCIP* scip) noexcept {
+	auto const* const installer =
+		dynamic_cast<RootBasisInstaller const*>(SCIPfindObjRelax(scip, installer_name));
+	return installer == nullptr ? 0 : installer->lp_iterations_saved();
+}
+
+}  // namespace scip
+}  // namespace ecole
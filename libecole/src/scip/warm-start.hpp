@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <scip/scip.h>
+
+#include "ecole/scip/basis-cache.hpp"
+#include "ecole/scip/type.hpp"
+
+namespace ecole {
+namespace scip {
+
+/**
+ * Include (once) the plugins recording and installing the root LP basis, and enable them.
+ *
+ * Enabling is done through a SCIP parameter, so that resetting parameters disables them.
+ */
+void enable_root_warm_start(
+	SCIP* scip,
+	std::shared_ptr<RootBasisCache> cache,
+	std::uint64_t fingerprint);
+
+/**
+ * Release the basis cache of the warm start plugins, if included, which stay disabled.
+ *
+ * The plugins themselves cannot be removed from the SCIP.
+ */
+void release_root_warm_start(SCIP* scip) noexcept;
+
+/**
+ * Root LP iterations saved by the warm start in the current solve, or zero if started cold.
+ */
+long_int root_lp_iterations_saved(SCIP* scip) noexcept;
+
+}  // namespace scip
+}  // namespace ecole
@@ -0,0 +1,25 @@
+#include <ctime>
+
+#include "ecole/utility/chrono.hpp"
+
+namespace ecole {
+namespace utility {
+
+std::chrono::nanoseconds thread_cpu_time() noexcept {
+	timespec time{};
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+	return std::chrono::seconds{time.tv_sec} + std::chrono::nanoseconds{time.tv_nsec};
+}
+
+ThreadTimer::ThreadTimer() noexcept :
+	cpu_start(thread_cpu_time()), wall_start(std::chrono::steady_clock::now()) {}
+
+Durations ThreadTimer::elapsed() const noexcept {
+	auto durations = Durations{};
+	durations.cpu = thread_cpu_time() - cpu_start;
+	durations.wall = std::chrono::steady_clock::now() - wall_start;
+	return durations;
+}
+
+}  // namespace utility
+}  // namespace ecole
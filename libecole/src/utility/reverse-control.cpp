@@ -43,21 +43,26 @@ auto Controller::Synchronizer::env_thread_is_done(lock_t const& lk) const noexce
 }
 
 auto Controller::Synchronizer::thread_start() -> lock_t {
-	return lock_t{model_mutex};
+	auto lk = lock_t{model_mutex};
+	timer = ThreadTimer{};
+	return lk;
 }
 
 auto Controller::Synchronizer::thread_hold_env(lock_t&& lk) -> lock_t {
 	validate_lock(lk);
+	record_thread_time();
 	thread_owns_model = false;
 	lk.unlock();
 	model_avail_cv.notify_one();
 	lk.lock();
 	model_avail_cv.wait(lk, [this] { return thread_owns_model; });
+	timer = ThreadTimer{};
 	return std::move(lk);
 }
 
 auto Controller::Synchronizer::thread_terminate(lock_t&& lk) -> void {
 	validate_lock(lk);
+	record_thread_time();
 	thread_owns_model = false;
 	thread_finished = true;
 	lk.unlock();
@@ -76,6 +81,19 @@ auto Controller::Synchronizer::thread_action_function(lock_t const& lk) const no
 	return std::move(action_func);
 }
 
+auto Controller::Synchronizer::thread_time() const noexcept -> Durations {
+	auto durations = Durations{};
+	durations.cpu = std::chrono::nanoseconds{cpu_time.load()};
+	durations.wall = std::chrono::nanoseconds{wall_time.load()};
+	return durations;
+}
+
+auto Controller::Synchronizer::record_thread_time() noexcept -> void {
+	auto const elapsed = timer.elapsed();
+	cpu_time += elapsed.cpu.count();
+	wall_time += elapsed.wall.count();
+}
+
 auto Controller::Synchronizer::validate_lock(lock_t const& lk) const noexcept -> void {
 	(void)lk;
 	assert(lk && (lk.mutex() == &model_mutex));
@@ -145,6 +163,10 @@ auto Controller::is_done() const noexcept -> bool {
 	return synchronizer->env_thread_is_done(model_lock);
 }
 
+auto Controller::thread_time() const noexcept -> Durations {
+	return synchronizer->thread_time();
+}
+
 auto Controller::stop_thread() -> void {
 	if (!model_lock.owns_lock()) model_lock = synchronizer->env_wait_thread();
 	synchronizer->env_stop_thread(std::move(model_lock));
@@ -1,3 +1,6 @@
+#include <string>
+
+#include <scip/cons_linear.h>
 #include <scip/scip.h>
 
 #include "conftest.hpp"
@@ -8,3 +11,27 @@ ecole::scip::Model get_model() {
 	model.disable_presolve();
 	return model;
 }
+
+ecole::scip::Model get_knapsack_model(double capacity) {
+	auto model = ecole::scip::Model{};
+	auto* const scip = model.get_scip_ptr();
+	SCIP_CALL_ABORT(SCIPcreateProbBasic(scip, "knapsack"));
+	SCIP_CALL_ABORT(SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE));
+	SCIP_CONS* cons = nullptr;
+	SCIP_CALL_ABORT(SCIPcreateConsBasicLinear(
+		scip, &cons, "capacity", 0, nullptr, nullptr, -SCIPinfinity(scip), capacity));
+	double const weights[] = {3., 4., 5., 6.};
+	double const values[] = {4., 5., 7., 8.};
+	for (auto i = 0; i < 4; ++i) {
+		SCIP_VAR* var = nullptr;
+		auto const name = "x" + std::to_string(i);
+		SCIP_CALL_ABORT(
+			SCIPcreateVarBasic(scip, &var, name.c_str(), 0., 1., values[i], SCIP_VARTYPE_BINARY));
+		SCIP_CALL_ABORT(SCIPaddVar(scip, var));
+		SCIP_CALL_ABORT(SCIPaddCoefLinear(scip, cons, var, weights[i]));
+		SCIP_CALL_ABORT(SCIPreleaseVar(scip, &var));
+	}
+	SCIP_CALL_ABORT(SCIPaddCons(scip, cons));
+	SCIP_CALL_ABORT(SCIPreleaseCons(scip, &cons));
+	return model;
+}
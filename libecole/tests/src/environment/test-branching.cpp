@@ -57,6 +57,39 @@ TEST_CASE("Branching environment", "[env]") {
 		SECTION("Run another trajectory") { run_trajectory(problem_file); }
 	}
 
+	SECTION("report information on transitions") {
+		decltype(env)::ActionSet action_set;
+		std::tie(std::ignore, action_set, std::ignore, std::ignore) = env.reset(problem_file);
+		auto done = false;
+		environment::Info info;
+		std::tie(std::ignore, std::ignore, std::ignore, done, info) = env.step(policy(action_set));
+		REQUIRE(info.memory.used > 0);
+		REQUIRE(info.memory.peak >= info.memory.total);
+		REQUIRE(info.n_nodes >= 1);
+		REQUIRE(info.timings.dynamics >= info.timings.solver);
+		REQUIRE(info.timings.handoff == info.timings.dynamics - info.timings.solver);
+		REQUIRE(info.timings.solver.count() > 0);
+		if (done) {
+			REQUIRE(info.done_reason == environment::DoneReason::Finished);
+		} else {
+			REQUIRE(info.done_reason == environment::DoneReason::NotDone);
+			REQUIRE(info.observation_memory > 0);
+		}
+	}
+
+	SECTION("stop when exceeding the memory budget") {
+		decltype(env)::ActionSet action_set;
+		std::tie(std::ignore, action_set, std::ignore, std::ignore) = env.reset(problem_file);
+		env.memory_budget() = 1;
+		auto done = false;
+		environment::Info info;
+		std::tie(std::ignore, action_set, std::ignore, done, info) = env.step(policy(action_set));
+		REQUIRE(done);
+		REQUIRE(info.done_reason == environment::DoneReason::MemoryLimit);
+		REQUIRE_FALSE(action_set.has_value());
+		REQUIRE_THROWS_AS(env.step(0), environment::Exception);
+	}
+
 	SECTION("manage errors") {
 		env.reset(problem_file);
 		auto const branch_var_too_large = std::numeric_limits<std::size_t>::max();
@@ -1,3 +1,4 @@
+#include <memory>
 #include <tuple>
 
 #include <catch2/catch.hpp>
@@ -8,6 +9,7 @@
 #include "ecole/none.hpp"
 #include "ecole/observation/nothing.hpp"
 #include "ecole/reward/constant.hpp"
+#include "ecole/scip/presolve-cache.hpp"
 #include "ecole/traits.hpp"
 
 #include "conftest.hpp"
@@ -125,3 +127,62 @@ TEST_CASE("Defaut Dynamics change seed every episode", "[dynamics]") {
 	auto seed2 = env.model().get_param<scip::Seed>("randomization/randomseedshift");
 	REQUIRE(seed1 != seed2);
 }
+
+TEST_CASE("Environments reuse the model on the same instance", "[env]") {
+	auto env = environment::TestEnv{};
+	env.reuse_model() = true;
+	auto done = false;
+	std::tie(std::ignore, std::ignore, std::ignore, done) = env.reset(problem_file);
+	auto const* const scip_ptr = env.model().get_scip_ptr();
+	auto const seed1 = env.model().get_param<scip::Seed>("randomization/randomseedshift");
+
+	SECTION("Same file") {
+		std::tie(std::ignore, std::ignore, std::ignore, done) = env.reset(problem_file);
+		REQUIRE(env.model().get_scip_ptr() == scip_ptr);
+		REQUIRE(env.dynamics().counter == 0ul);
+		REQUIRE(env.model().get_param<scip::Seed>("randomization/randomseedshift") != seed1);
+	}
+
+	SECTION("Same model") {
+		auto const model = scip::Model::from_file(problem_file);
+		env.reset(model);
+		REQUIRE(env.model().get_scip_ptr() == scip_ptr);
+	}
+
+	SECTION("After a full episode") {
+		while (!done) {
+			std::tie(std::ignore, std::ignore, std::ignore, done, std::ignore) = env.step(3.0);
+		}
+		std::tie(std::ignore, std::ignore, std::ignore, done) = env.reset(problem_file);
+		REQUIRE(env.model().get_scip_ptr() == scip_ptr);
+		REQUIRE_FALSE(done);
+	}
+
+	SECTION("Not on a model with other constraint sides") {
+		env.reset(get_knapsack_model(10.));
+		env.reset(get_knapsack_model(11.));
+		SCIP_Bool success = false;
+		auto* const cons = SCIPgetOrigConss(env.model().get_scip_ptr())[0];
+		REQUIRE(SCIPconsGetRhs(env.model().get_scip_ptr(), cons, &success) == 11.);
+	}
+
+	SECTION("Not when disabled") {
+		env.reuse_model() = false;
+		env.reset(problem_file);
+		REQUIRE(env.model().get_scip_ptr() != scip_ptr);
+	}
+}
+
+TEST_CASE("Environments start from cached presolved problems", "[env]") {
+	auto env = environment::TestEnv{};
+	auto cache = std::make_shared<scip::PresolveCache>();
+	env.presolve_cache() = cache;
+	for (auto i = 0; i < 2; ++i) {
+		env.reset(problem_file);
+		REQUIRE(env.presolved_problem() != nullptr);
+		REQUIRE(env.model().get_param<int>("presolving/maxrounds") == 0);
+	}
+	REQUIRE(cache->size() == 1);
+	REQUIRE(cache->n_hits() == 1);
+	REQUIRE(cache->n_misses() == 1);
+}
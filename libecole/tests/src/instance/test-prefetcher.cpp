@@ -0,0 +1,87 @@
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/instance/prefetcher.hpp"
+#include "ecole/instance/source.hpp"
+#include "ecole/scip/model.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("File sources read instances in order", "[instance]") {
+	SECTION("Without cycling") {
+		auto source = instance::FileSource{{problem_file, problem_file}};
+		REQUIRE(source.next().has_value());
+		REQUIRE(source.next().has_value());
+		REQUIRE_FALSE(source.next().has_value());
+	}
+
+	SECTION("With cycling") {
+		auto source = instance::FileSource{{problem_file}, true};
+		for (auto i = 0; i < 3; ++i) {
+			REQUIRE(source.next().has_value());
+		}
+	}
+
+	SECTION("From a glob pattern") {
+		auto const source = instance::FileSource::from_glob(TEST_DATA_DIR "/*.mps");
+		REQUIRE(source.filenames().size() == 2);
+		REQUIRE_THROWS(instance::FileSource::from_glob(TEST_DATA_DIR "/*.nothing"));
+	}
+}
+
+TEST_CASE("Prefetcher loads instances ahead of time", "[instance]") {
+	auto const n_instances = std::size_t{5};
+	auto count = std::atomic<std::size_t>{0};
+	auto generate = [&count]() -> nonstd::optional<scip::Model> {
+		if (count == n_instances) return {};
+		++count;
+		return get_model();
+	};
+	auto source = std::make_shared<instance::GeneratorSource>(generate);
+
+	SECTION("Take all instances") {
+		auto prefetcher = instance::InstancePrefetcher{source, 2};
+		for (auto i = 0ul; i < n_instances; ++i) {
+			auto model = prefetcher.next();
+			REQUIRE(model.has_value());
+			REQUIRE(model->get_stage() == SCIP_STAGE_PROBLEM);
+		}
+		REQUIRE_FALSE(prefetcher.next().has_value());
+		auto const stats = prefetcher.stats();
+		REQUIRE(stats.n_instances == n_instances);
+		REQUIRE(stats.n_ready == 0);
+		REQUIRE(stats.n_stalls <= n_instances);
+	}
+
+	SECTION("Keep at most n_ahead instances") {
+		auto prefetcher = instance::InstancePrefetcher{source, 2};
+		prefetcher.next();
+		// Give time to the background thread to fill the buffer
+		while (prefetcher.stats().n_ready < 2) {
+			std::this_thread::yield();
+		}
+		REQUIRE(prefetcher.stats().n_ready == 2);
+		REQUIRE(count == 3);
+	}
+
+	SECTION("Close with instances not taken") {
+		auto prefetcher = instance::InstancePrefetcher{source, 2};
+		prefetcher.close();
+		REQUIRE_FALSE(prefetcher.next().has_value());
+	}
+}
+
+TEST_CASE("Prefetcher rethrows loading errors", "[instance]") {
+	auto fail = []() -> nonstd::optional<scip::Model> { throw std::runtime_error{"Cannot load"}; };
+	auto source = std::make_shared<instance::GeneratorSource>(fail);
+	auto prefetcher = instance::InstancePrefetcher{source, 1};
+	REQUIRE_THROWS_AS(prefetcher.next(), std::runtime_error);
+}
@@ -0,0 +1,45 @@
+#include <memory>
+#include <string>
+
+#include <catch2/catch.hpp>
+#include <nonstd/variant.hpp>
+
+#include "ecole/none.hpp"
+#include "ecole/observation/dict.hpp"
+#include "ecole/observation/nodebipartite.hpp"
+#include "ecole/observation/nothing.hpp"
+#include "ecole/observation/tuple.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("TupleFunction packs observations at compile time") {
+	auto obs_func =
+		observation::make_tuple_function(observation::NodeBipartite{}, observation::Nothing{});
+	auto model = get_model();
+	model.solve_iter();
+	obs_func.reset(model);
+
+	auto const obs = obs_func.obtain_observation(model);
+	REQUIRE(std::get<0>(obs).has_value());
+	REQUIRE(std::get<0>(obs)->column_features.size() > 0);
+	REQUIRE(observation::buffer_size(obs) == observation::buffer_size(std::get<0>(obs)));
+}
+
+TEST_CASE("DictFunction packs type erased observations") {
+	using Observation = nonstd::variant<NoneType, observation::NodeBipartite::Observation>;
+	auto obs_func = observation::DictFunction<Observation>{};
+	obs_func.insert_adapted("node", std::make_shared<observation::NodeBipartite>());
+	obs_func.insert_adapted("nothing", std::make_shared<observation::Nothing>());
+	auto model = get_model();
+	model.solve_iter();
+	obs_func.reset(model);
+
+	auto const obs = obs_func.obtain_observation(model);
+	REQUIRE(obs.size() == 2);
+	REQUIRE(nonstd::holds_alternative<NoneType>(obs.at("nothing")));
+	auto const& node_obs = nonstd::get<observation::NodeBipartite::Observation>(obs.at("node"));
+	REQUIRE(node_obs.has_value());
+	REQUIRE(observation::buffer_size(obs) == observation::buffer_size(node_obs));
+}
@@ -0,0 +1,36 @@
+#include <memory>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/reward/arithmetic.hpp"
+#include "ecole/reward/constant.hpp"
+#include "ecole/reward/isdone.hpp"
+#include "ecole/reward/lpiterations.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("Arithmetic on reward functions") {
+	using reward::BinaryArithmetic;
+	using reward::Reward;
+	using reward::UnaryArithmetic;
+
+	auto model = get_model();
+	auto const minus = [](Reward x) { return -x; };
+	auto const add = [](Reward x, Reward y) { return x + y; };
+	auto const mul = [](Reward x, Reward y) { return x * y; };
+
+	// -LpIterations() + 2 * IsDone()
+	auto func = BinaryArithmetic{
+		add,
+		std::make_shared<UnaryArithmetic>(minus, std::make_shared<reward::LpIterations>()),
+		std::make_shared<BinaryArithmetic>(
+			mul, std::make_shared<reward::Constant>(2.), std::make_shared<reward::IsDone>()),
+	};
+
+	func.reset(model);
+	REQUIRE(func.obtain_reward(model) == 0.);
+	model.solve();
+	REQUIRE(func.obtain_reward(model, true) > 2.);
+}
@@ -6,6 +6,7 @@
 #include "ecole/environment/configuring.hpp"
 #include "ecole/observation/nothing.hpp"
 #include "ecole/reward/lpiterations.hpp"
+#include "ecole/scip/basis-cache.hpp"
 
 #include "conftest.hpp"
 
@@ -39,3 +40,18 @@ TEST_CASE("Using the reward in a Configuring environment") {
 		REQUIRE(reward == 0);
 	}
 }
+
+TEST_CASE("LpIterations reports the LP iterations saved by warm start") {
+	auto env = environment::Configuring<observation::Nothing, reward::LpIterations>{};
+	env.root_basis_cache() = std::make_shared<scip::RootBasisCache>();
+	auto const model = get_model();
+
+	env.reset(model);
+	env.step({});
+	REQUIRE(env.reward_func().lp_iterations_saved() == 0);
+
+	env.reset(model);
+	env.step({});
+	REQUIRE(env.reward_func().lp_iterations_saved() > 0);
+	REQUIRE(env.reward_func().lp_iterations_saved() == env.model().root_lp_iterations_saved());
+}
@@ -0,0 +1,31 @@
+#include <catch2/catch.hpp>
+
+#include "ecole/reward/nnodes.hpp"
+#include "ecole/reward/progress.hpp"
+#include "ecole/reward/treesize.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("Node based rewards") {
+	auto model = get_model();
+	auto nnodes = reward::NNodes{};
+	auto treesize = reward::TreeSize{};
+	auto progress = reward::Progress{};
+	nnodes.reset(model);
+	treesize.reset(model);
+	progress.reset(model);
+
+	model.solve();
+	auto const n_nodes = static_cast<double>(model.stats().n_nodes);
+	REQUIRE(nnodes.obtain_reward(model) == -n_nodes);
+	REQUIRE(treesize.obtain_reward(model) == -n_nodes);
+	REQUIRE(nnodes.obtain_reward(model) == 0);
+
+	auto const rewards = progress.obtain_rewards(model);
+	REQUIRE(rewards.n_nodes == -n_nodes);
+	REQUIRE(rewards.tree_size == -n_nodes);
+	REQUIRE(rewards.lp_iterations == -static_cast<double>(model.stats().n_lp_iterations));
+	REQUIRE(rewards.solving_time < 0);
+}
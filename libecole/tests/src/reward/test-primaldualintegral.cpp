@@ -0,0 +1,34 @@
+#include <tuple>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/environment/branching.hpp"
+#include "ecole/observation/nothing.hpp"
+#include "ecole/reward/primaldualintegral.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("Using PrimalDualIntegral in a Branching environment") {
+	auto env = environment::Branching<observation::Nothing, reward::PrimalDualIntegral>{};
+
+	for (auto i = 0; i < 2; ++i) {
+		auto obs_as_rew_done = env.reset(problem_file);
+		auto total = std::get<2>(obs_as_rew_done);
+		REQUIRE(total <= 0);
+
+		auto done = std::get<3>(obs_as_rew_done);
+		auto action_set = std::get<1>(obs_as_rew_done);
+		while (!done) {
+			auto obs_as_rew_done_info = env.step(action_set.value()[0]);
+			REQUIRE(std::get<2>(obs_as_rew_done_info) <= 0);
+			total += std::get<2>(obs_as_rew_done_info);
+			done = std::get<3>(obs_as_rew_done_info);
+			action_set = std::get<1>(obs_as_rew_done_info);
+		}
+
+		// The integral is bounded by the solving time since the gap function is at most one
+		REQUIRE(-total <= env.model().stats().solving_time + 1e-6);
+	}
+}
@@ -0,0 +1,63 @@
+#include <chrono>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/environment/branching.hpp"
+#include "ecole/observation/nothing.hpp"
+#include "ecole/reward/solvingtime.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("Using SolvingTime in a Branching environment") {
+	auto const wall = GENERATE(true, false);
+	auto env = environment::Branching<observation::Nothing, reward::SolvingTime>{{}, {wall}};
+
+	auto model = get_model();
+	model.set_param("limits/totalnodes", 5);
+	auto obs_as_rew_done = env.reset(model);
+	REQUIRE(std::get<2>(obs_as_rew_done) < 0);
+	auto total = std::get<2>(obs_as_rew_done);
+
+	auto done = std::get<3>(obs_as_rew_done);
+	auto action_set = std::get<1>(obs_as_rew_done);
+	while (!done) {
+		auto obs_as_rew_done_info = env.step(action_set.value()[0]);
+		REQUIRE(std::get<2>(obs_as_rew_done_info) <= 0);
+		total += std::get<2>(obs_as_rew_done_info);
+		done = std::get<3>(obs_as_rew_done_info);
+		action_set = std::get<1>(obs_as_rew_done_info);
+	}
+
+	auto const time = env.model().solver_time();
+	auto const expected = wall ? time.wall : time.cpu;
+	REQUIRE(-total == Approx(std::chrono::duration<double>{expected}.count()));
+}
+
+TEST_CASE("SolvingTime does not count previous episodes of a reused model") {
+	auto env = environment::Branching<observation::Nothing, reward::SolvingTime>{};
+	env.reuse_model() = true;
+
+	auto model = get_model();
+	model.set_param("limits/totalnodes", 100);
+	auto obs_as_rew_done = env.reset(model);
+	auto first_total = std::get<2>(obs_as_rew_done);
+	auto done = std::get<3>(obs_as_rew_done);
+	auto action_set = std::get<1>(obs_as_rew_done);
+	while (!done) {
+		auto obs_as_rew_done_info = env.step(action_set.value()[0]);
+		first_total += std::get<2>(obs_as_rew_done_info);
+		done = std::get<3>(obs_as_rew_done_info);
+		action_set = std::get<1>(obs_as_rew_done_info);
+	}
+
+	auto const* const scip_ptr = env.model().get_scip_ptr();
+	auto const offset = std::get<2>(env.reset(model));
+	REQUIRE(env.model().get_scip_ptr() == scip_ptr);
+	// Only the solving up to the first branching, not the previous episode
+	REQUIRE(offset > first_total);
+	auto const time = std::chrono::duration<double>{env.model().solver_time().cpu};
+	REQUIRE(-offset == Approx(time.count()));
+}
@@ -1,12 +1,19 @@
+#include <cstddef>
+#include <fstream>
 #include <future>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <catch2/catch.hpp>
 #include <scip/scip.h>
 
+#include "ecole/scip/basis-cache.hpp"
 #include "ecole/scip/exception.hpp"
 #include "ecole/scip/model.hpp"
+#include "ecole/scip/presolve-cache.hpp"
 
 #include "conftest.hpp"
 
@@ -27,10 +34,46 @@ TEST_CASE("Create model from file") {
 	auto model = scip::Model::from_file(problem_file);
 }
 
+TEST_CASE("Create model with a plugin profile") {
+	auto const profile = GENERATE(scip::PluginProfile::Full, scip::PluginProfile::MinimalBranching);
+	auto model = scip::Model::from_file(problem_file, profile);
+	model.disable_cuts();
+	model.disable_presolve();
+	model.solve();
+	REQUIRE(model.is_solved());
+	REQUIRE(model.copy_orig().write_orig_prob_buffer("lp") == model.write_orig_prob_buffer("lp"));
+}
+
+TEST_CASE("Plugin profiles names") {
+	auto const profile = GENERATE(scip::PluginProfile::Full, scip::PluginProfile::MinimalBranching);
+	REQUIRE(scip::plugin_profile_from_string(scip::to_string(profile)) == profile);
+	REQUIRE_THROWS_AS(scip::plugin_profile_from_string("not-a-profile"), scip::Exception);
+}
+
 TEST_CASE("Raise if file does not exist") {
 	REQUIRE_THROWS_AS(scip::Model::from_file("/does_not_exist.mps"), scip::Exception);
 }
 
+TEST_CASE("Create model from memory buffer") {
+	auto file = std::ifstream{problem_file, std::ios::binary};
+	auto const content = std::vector<char>{std::istreambuf_iterator<char>{file}, {}};
+	auto const model = scip::Model::from_buffer(content, "mps");
+	REQUIRE(model.variables().size == scip::Model::from_file(problem_file).variables().size);
+
+	SECTION("Raise on invalid content") {
+		auto const garbage = std::string{"not a problem"};
+		REQUIRE_THROWS_AS(scip::Model::from_buffer(garbage, "lp"), scip::Exception);
+	}
+}
+
+TEST_CASE("Write model into memory buffer") {
+	auto const model = scip::Model::from_file(problem_file);
+	auto const buffer = model.write_orig_prob_buffer("mps");
+	REQUIRE(buffer.size() > 0);
+	auto const model_copy = scip::Model::from_buffer(buffer, "mps");
+	REQUIRE(model_copy.variables().size == model.variables().size);
+}
+
 TEST_CASE("Model solving") {
 	SECTION("Synchronously") {
 		auto model = get_model();
@@ -48,6 +91,244 @@ TEST_CASE("Model solving") {
 	}
 }
 
+TEST_CASE("Memory statistics") {
+	auto model = get_model();
+	auto const before = model.memory_stats();
+	REQUIRE(before.used > 0);
+	REQUIRE(before.total >= before.used);
+	REQUIRE(before.peak >= before.total);
+	model.solve();
+	auto const after = model.memory_stats();
+	REQUIRE(after.peak >= before.peak);
+	REQUIRE(after.peak >= after.total);
+}
+
+TEST_CASE("Solver statistics snapshot") {
+	auto model = get_model();
+	auto const before = model.stats();
+	REQUIRE(before.n_nodes == 0);
+	REQUIRE(before.n_lp_iterations == 0);
+	REQUIRE(before.depth == -1);
+
+	SECTION("During solving") {
+		model.solve_iter();
+		auto const stats = model.stats();
+		REQUIRE(stats.n_lp_iterations > 0);
+		REQUIRE(stats.depth >= 0);
+		REQUIRE(stats.dual_bound <= stats.primal_bound);
+	}
+
+	SECTION("After solving") {
+		model.solve();
+		auto const stats = model.stats();
+		REQUIRE(stats.n_nodes >= 1);
+		REQUIRE(stats.gap == Approx(0.));
+		REQUIRE(stats.memory.peak > 0);
+	}
+}
+
+TEST_CASE("Bulk LP arrays match proxies") {
+	auto model = get_model();
+	model.solve_iter();
+	REQUIRE_FALSE(model.solve_iter_is_done());
+	auto const inf = std::numeric_limits<double>::infinity();
+
+	SECTION("Columns") {
+		auto const arrays = model.lp_columns_arrays();
+		auto const columns = model.lp_columns();
+		REQUIRE(arrays.lb.size() == columns.size);
+		auto i = std::size_t{0};
+		for (auto const col : columns) {
+			REQUIRE(arrays.lb[i] == col.lb().value_or(-inf));
+			REQUIRE(arrays.ub[i] == col.ub().value_or(inf));
+			REQUIRE(arrays.obj[i] == col.obj());
+			REQUIRE(arrays.prim_sol[i] == col.prim_sol());
+			REQUIRE(arrays.reduced_cost[i] == col.reduced_cost());
+			REQUIRE(arrays.basis_status[i] == col.basis_status());
+			++i;
+		}
+	}
+
+	SECTION("Rows") {
+		auto const arrays = model.lp_rows_arrays();
+		auto const rows = model.lp_rows();
+		REQUIRE(arrays.lhs.size() == rows.size);
+		auto i = std::size_t{0};
+		for (auto const row : rows) {
+			REQUIRE(arrays.lhs[i] == row.lhs().value_or(-inf));
+			REQUIRE(arrays.rhs[i] == row.rhs().value_or(inf));
+			REQUIRE(arrays.l2_norm[i] == row.l2_norm());
+			REQUIRE(arrays.lp_activity[i] == row.lp_activity());
+			REQUIRE(arrays.dual_sol[i] == row.dual_sol());
+			++i;
+		}
+	}
+
+	SECTION("Reuse arrays") {
+		auto arrays = model.lp_columns_arrays();
+		auto const* const data = arrays.lb.data();
+		model.lp_columns_arrays(arrays);
+		REQUIRE(arrays.lb.data() == data);
+	}
+}
+
+TEST_CASE("Bulk LP arrays are only available during solving") {
+	auto model = get_model();
+	REQUIRE_THROWS_AS(model.lp_columns_arrays(), scip::Exception);
+	REQUIRE_THROWS_AS(model.lp_rows_arrays(), scip::Exception);
+}
+
+TEST_CASE("Capture solver log") {
+	auto model = get_model();
+	REQUIRE(model.log_tail().empty());
+
+	SECTION("Capture the whole log") {
+		model.enable_log_capture();
+		model.solve();
+		REQUIRE_FALSE(model.log_tail().empty());
+		REQUIRE(model.log_tail(10).size() == 10);
+	}
+
+	SECTION("Keep only the latest characters") {
+		model.enable_log_capture(16);
+		model.solve();
+		REQUIRE(model.log_tail().size() == 16);
+	}
+
+	SECTION("Disable capture") {
+		model.enable_log_capture();
+		model.disable_log_capture();
+		model.solve();
+		REQUIRE(model.log_tail().empty());
+	}
+}
+
+TEST_CASE("Fingerprint identifies the instance") {
+	auto const model = get_model();
+	REQUIRE(model.fingerprint() == model.copy_orig().fingerprint());
+	REQUIRE(model.fingerprint() != scip::Model{}.fingerprint());
+	// Problems differing only in a constraint side or in the objective sense
+	REQUIRE(get_knapsack_model(10.).fingerprint() == get_knapsack_model(10.).fingerprint());
+	REQUIRE(get_knapsack_model(10.).fingerprint() != get_knapsack_model(11.).fingerprint());
+	auto minimize = get_knapsack_model(10.);
+	SCIPsetObjsense(minimize.get_scip_ptr(), SCIP_OBJSENSE_MINIMIZE);
+	REQUIRE(minimize.fingerprint() != get_knapsack_model(10.).fingerprint());
+}
+
+TEST_CASE("Warm start root LP from cached basis") {
+	auto const model = get_model();
+	auto cache = std::make_shared<scip::RootBasisCache>();
+	auto solve_warm = [&] {
+		auto warm = model.copy_orig();
+		warm.enable_root_warm_start(cache);
+		warm.solve();
+		return warm.root_lp_iterations_saved();
+	};
+
+	REQUIRE(solve_warm() == 0);
+	REQUIRE(cache->size() == 1);
+	REQUIRE(cache->n_warm_starts() == 0);
+	auto const cold_lp_iterations = cache->get(model.fingerprint())->lp_iterations;
+	REQUIRE(cold_lp_iterations > 0);
+
+	// The second root LP needs fewer iterations than the cold one
+	auto const lp_iterations_saved = solve_warm();
+	REQUIRE(lp_iterations_saved > 0);
+	REQUIRE(lp_iterations_saved <= cold_lp_iterations);
+	REQUIRE(cache->size() == 1);
+	REQUIRE(cache->n_warm_starts() == 1);
+	REQUIRE(cache->lp_iterations_saved() == lp_iterations_saved);
+}
+
+TEST_CASE("Presolved problem maps back to the original variables") {
+	// Presolving enabled, unlike get_model()
+	auto const model = scip::Model::from_file(problem_file);
+	auto const problem = scip::PresolvedProblem::presolve(model);
+	auto const n_orig_vars = SCIPgetNOrigVars(model.get_scip_ptr());
+	REQUIRE(problem.original_variables().size() == static_cast<std::size_t>(n_orig_vars));
+	REQUIRE(problem.model().get_stage() == SCIP_STAGE_PROBLEM);
+
+	auto presolved = problem.model().copy_orig();
+	presolved.solve();
+	auto* const presolved_scip = presolved.get_scip_ptr();
+	auto const n_presolved_vars = SCIPgetNOrigVars(presolved_scip);
+	REQUIRE(n_presolved_vars < n_orig_vars);
+	auto values = std::vector<SCIP_Real>(static_cast<std::size_t>(n_presolved_vars));
+	auto* const best_sol = SCIPgetBestSol(presolved_scip);
+	REQUIRE(best_sol != nullptr);
+	SCIP_VAR** const presolved_vars = SCIPgetOrigVars(presolved_scip);
+	REQUIRE(
+		SCIPgetSolVals(presolved_scip, best_sol, n_presolved_vars, presolved_vars, values.data()) ==
+		SCIP_OKAY);
+	auto original_values = problem.to_original(values);
+
+	// The solution mapped back is feasible for the original problem
+	auto original = model.copy_orig();
+	auto* const original_scip = original.get_scip_ptr();
+	SCIP_SOL* sol = nullptr;
+	REQUIRE(SCIPcreateOrigSol(original_scip, &sol, nullptr) == SCIP_OKAY);
+	SCIP_VAR** const orig_vars = SCIPgetOrigVars(original_scip);
+	auto* const orig_values = original_values.data();
+	REQUIRE(SCIPsetSolVals(original_scip, sol, n_orig_vars, orig_vars, orig_values) == SCIP_OKAY);
+	SCIP_Bool feasible = false;
+	REQUIRE(SCIPcheckSolOrig(original_scip, sol, &feasible, false, false) == SCIP_OKAY);
+	REQUIRE(SCIPfreeSol(original_scip, &sol) == SCIP_OKAY);
+	REQUIRE(feasible);
+}
+
+TEST_CASE("Presolve cache is keyed by instance and parameters") {
+	auto const model = scip::Model::from_file(problem_file);
+	auto cache = scip::PresolveCache{};
+
+	auto const problem = cache.get_or_presolve(model);
+	REQUIRE(problem != nullptr);
+	auto const n_presolved_vars = SCIPgetNOrigVars(problem->model().get_scip_ptr());
+	REQUIRE(n_presolved_vars < SCIPgetNOrigVars(model.get_scip_ptr()));
+	REQUIRE(cache.size() == 1);
+	REQUIRE(cache.n_misses() == 1);
+	REQUIRE(cache.n_hits() == 0);
+
+	SECTION("Hit on copies with different seeds") {
+		auto copy = model.copy_orig();
+		copy.set_param("randomization/randomseedshift", 7);
+		REQUIRE(cache.get_or_presolve(copy) == problem);
+		REQUIRE(cache.n_hits() == 1);
+		REQUIRE(cache.size() == 1);
+	}
+
+	SECTION("Miss on different presolving parameters") {
+		auto copy = model.copy_orig();
+		copy.set_param("presolving/maxrounds", 1);
+		REQUIRE(cache.get_or_presolve(copy) != problem);
+		REQUIRE(cache.n_misses() == 2);
+		REQUIRE(cache.size() == 2);
+	}
+
+	SECTION("Miss on a different constraint side") {
+		auto const knapsack = cache.get_or_presolve(get_knapsack_model(10.));
+		REQUIRE(cache.get_or_presolve(get_knapsack_model(10.)) == knapsack);
+		REQUIRE(cache.get_or_presolve(get_knapsack_model(11.)) != knapsack);
+		auto const key = scip::PresolveCache::key(get_knapsack_model(10.));
+		REQUIRE(scip::PresolveCache::key(get_knapsack_model(11.)) != key);
+		REQUIRE(cache.n_misses() == 3);
+		REQUIRE(cache.size() == 3);
+	}
+}
+
+TEST_CASE("Presolving that ends the solve is not used") {
+	// Presolving fixes all the items out of an empty knapsack and solves the problem
+	auto const model = get_knapsack_model(0.);
+	REQUIRE(scip::PresolvedProblem::try_presolve(model) == nullptr);
+	REQUIRE_THROWS_AS(scip::PresolvedProblem::presolve(model), scip::Exception);
+
+	auto cache = scip::PresolveCache{};
+	REQUIRE(cache.get_or_presolve(model) == nullptr);
+	REQUIRE(cache.get_or_presolve(model) == nullptr);
+	REQUIRE(cache.n_misses() == 1);
+	REQUIRE(cache.n_hits() == 1);
+	REQUIRE(cache.time_saved().count() == 0);
+}
+
 TEST_CASE("Get and set parameters") {
 	using scip::ParamType;
 
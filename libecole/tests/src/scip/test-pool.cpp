@@ -0,0 +1,135 @@
+#include <memory>
+#include <tuple>
+
+#include <catch2/catch.hpp>
+#include <scip/scip.h>
+
+#include "ecole/environment/branching.hpp"
+#include "ecole/observation/nothing.hpp"
+#include "ecole/reward/primaldualintegral.hpp"
+#include "ecole/scip/basis-cache.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/pool.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+/**
+ * Enable the global pool for the duration of a test.
+ */
+struct PoolGuard {
+	PoolGuard() { scip::ModelPool::global().set_capacity(2); }
+	~PoolGuard() { scip::ModelPool::global().set_capacity(0); }
+};
+
+TEST_CASE("Disabled pool does not keep SCIP objects") {
+	{ auto model = get_model(); }
+	REQUIRE(scip::ModelPool::global().size() == 0);
+}
+
+TEST_CASE("Pool recycles SCIP objects") {
+	auto const guard = PoolGuard{};
+	auto& pool = scip::ModelPool::global();
+
+	SCIP* scip_ptr = nullptr;
+	{
+		auto model = get_model();
+		model.set_param("limits/nodes", 5);
+		model.solve();
+		scip_ptr = model.get_scip_ptr();
+	}
+	REQUIRE(pool.size() == 1);
+
+	SECTION("Recycled SCIP is clean") {
+		auto model = scip::Model{};
+		REQUIRE(model.get_scip_ptr() == scip_ptr);
+		REQUIRE(pool.size() == 0);
+		REQUIRE(model.get_stage() == SCIP_STAGE_INIT);
+		REQUIRE(model.get_param<long>("limits/nodes") == -1);
+	}
+
+	SECTION("Recycled SCIP can read and solve a problem") {
+		auto model = scip::Model::from_file(problem_file);
+		REQUIRE(model.get_scip_ptr() == scip_ptr);
+		model.disable_cuts();
+		model.disable_presolve();
+		model.solve_iter();
+		while (!model.solve_iter_is_done()) {
+			model.solve_iter_branch(model.lp_branch_cands()[0]);
+		}
+	}
+
+	SECTION("Copy reuses pooled SCIP") {
+		auto const original = get_model();
+		auto const copy = original.copy_orig();
+		REQUIRE(copy.get_scip_ptr() == scip_ptr);
+		REQUIRE(copy.write_orig_prob_buffer("lp") == original.write_orig_prob_buffer("lp"));
+	}
+
+	SECTION("Pool does not exceed its capacity") {
+		{
+			auto model1 = get_model();
+			auto model2 = get_model();
+			auto model3 = get_model();
+		}
+		REQUIRE(pool.size() == 2);
+	}
+}
+
+TEST_CASE("Pool recycles SCIP objects of environments") {
+	using Env = environment::Branching<observation::Nothing, reward::PrimalDualIntegral>;
+	auto const guard = PoolGuard{};
+	auto& pool = scip::ModelPool::global();
+
+	auto const run_episode = [](Env& env) {
+		auto done = false;
+		auto action_set = Env::ActionSet{};
+		std::tie(std::ignore, action_set, std::ignore, done) = env.reset(problem_file);
+		while (!done) {
+			std::tie(std::ignore, action_set, std::ignore, done, std::ignore) =
+				env.step(action_set.value()[0]);
+		}
+		return env.model().get_scip_ptr();
+	};
+
+	auto env = Env{};
+	env.root_basis_cache() = std::make_shared<scip::RootBasisCache>();
+	auto* const first_scip = run_episode(env);
+	// The model of the first episode is released once replaced by the one of the second
+	run_episode(env);
+	REQUIRE(pool.size() == 1);
+	auto const n_branchrules = SCIPgetNBranchrules(first_scip);
+	auto const n_eventhdlrs = SCIPgetNEventhdlrs(first_scip);
+
+	SECTION("Environment reset gets the pooled SCIP back, with its plugins") {
+		REQUIRE(run_episode(env) == first_scip);
+		REQUIRE(SCIPfindBranchrule(first_scip, "ecole::ReverseBranchrule") != nullptr);
+		REQUIRE(SCIPgetNBranchrules(first_scip) == n_branchrules);
+		REQUIRE(SCIPgetNEventhdlrs(first_scip) == n_eventhdlrs);
+	}
+
+	SECTION("Pooled SCIP has Ecole plugins disabled") {
+		auto model = scip::Model::from_file(problem_file);
+		REQUIRE(model.get_scip_ptr() == first_scip);
+		REQUIRE(model.get_param<bool>("ecole/rootwarmstart") == false);
+		model.disable_presolve();
+		model.solve();
+		REQUIRE(model.get_stage() == SCIP_STAGE_SOLVED);
+	}
+}
+
+TEST_CASE("Pool does not recycle SCIP objects with foreign plugins") {
+	auto const guard = PoolGuard{};
+	auto& pool = scip::ModelPool::global();
+
+	{
+		auto model = scip::Model{};
+		auto* const scip = model.get_scip_ptr();
+		auto* const exec = +[](SCIP*, SCIP_EVENTHDLR*, SCIP_EVENT*, SCIP_EVENTDATA*) {
+			return SCIP_OKAY;
+		};
+		REQUIRE(SCIPincludeEventhdlrBasic(scip, nullptr, "foreign", "", exec, nullptr) == SCIP_OKAY);
+	}
+	REQUIRE(pool.size() == 0);
+}
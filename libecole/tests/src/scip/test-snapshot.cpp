@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "ecole/scip/exception.hpp"
+#include "ecole/scip/model.hpp"
+
+#include "conftest.hpp"
+
+using namespace ecole;
+
+TEST_CASE("Snapshot round trip preserves the problem") {
+	auto const model = scip::Model::from_file(problem_file);
+	auto const snapshot = model.write_snapshot();
+	auto const loaded = scip::Model::from_snapshot(snapshot);
+	REQUIRE(loaded.write_orig_prob_buffer("lp") == model.write_orig_prob_buffer("lp"));
+
+	SECTION("From a misaligned buffer") {
+		auto shifted = std::vector<char>(snapshot.size() + 1);
+		std::copy(snapshot.begin(), snapshot.end(), shifted.begin() + 1);
+		auto const span = nonstd::span<char const>{shifted.data() + 1, snapshot.size()};
+		auto const loaded_shifted = scip::Model::from_snapshot(span);
+		REQUIRE(loaded_shifted.write_orig_prob_buffer("lp") == model.write_orig_prob_buffer("lp"));
+	}
+
+	SECTION("Through a file") {
+		auto const filename = std::string{"test-snapshot.snap"};
+		model.write_snapshot_file(filename);
+		auto const loaded_file = scip::Model::from_snapshot_file(filename);
+		std::remove(filename.c_str());
+		REQUIRE(loaded_file.write_orig_prob_buffer("lp") == model.write_orig_prob_buffer("lp"));
+	}
+}
+
+TEST_CASE("Snapshot can be solved") {
+	auto model = scip::Model::from_snapshot(scip::Model::from_file(problem_file).write_snapshot());
+	model.disable_cuts();
+	model.disable_presolve();
+	model.solve();
+	REQUIRE(model.is_solved());
+}
+
+TEST_CASE("Raise on invalid snapshots") {
+	auto snapshot = scip::Model::from_file(problem_file).write_snapshot();
+
+	SECTION("Truncated") {
+		snapshot.resize(snapshot.size() / 2);
+		REQUIRE_THROWS_AS(scip::Model::from_snapshot(snapshot), scip::Exception);
+	}
+
+	SECTION("Wrong magic number") {
+		snapshot[0] = 'X';
+		REQUIRE_THROWS_AS(scip::Model::from_snapshot(snapshot), scip::Exception);
+	}
+
+	SECTION("File does not exist") {
+		REQUIRE_THROWS_AS(scip::Model::from_snapshot_file("/does_not_exist.snap"), scip::Exception);
+	}
+}
@@ -0,0 +1,57 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "ecole/scip/exception.hpp"
+#include "ecole/scip/model.hpp"
+
+namespace {
+
+constexpr auto snapshot_extension = ".snap";
+
+bool is_snapshot(std::string const& filename) {
+	auto const ext = std::string{snapshot_extension};
+	return filename.size() >= ext.size() &&
+				 filename.compare(filename.size() - ext.size(), ext.size(), ext) == 0;
+}
+
+std::string extension(std::string const& filename) {
+	auto const dot = filename.rfind('.');
+	return dot == std::string::npos ? std::string{} : filename.substr(dot + 1);
+}
+
+}  // namespace
+
+/**
+ * Convert problems between any format readable by SCIP and Ecole snapshots.
+ *
+ * The direction of the conversion is given by the file extensions, snapshots ending in ".snap".
+ */
+int main(int argc, char** argv) {
+	if (argc != 3) {
+		std::cerr << "Usage: " << argv[0] << " INPUT OUTPUT\n"
+							<< "Convert a problem file to or from an Ecole snapshot (" << snapshot_extension
+							<< ").\n";
+		return EXIT_FAILURE;
+	}
+	auto const input = std::string{argv[1]};
+	auto const output = std::string{argv[2]};
+
+	try {
+		auto model = is_snapshot(input) ? ecole::scip::Model::from_snapshot_file(input) :
+																			ecole::scip::Model::from_file(input);
+		if (is_snapshot(output)) {
+			model.write_snapshot_file(output);
+		} else {
+			auto const content = model.write_orig_prob_buffer(extension(output));
+			auto file = std::ofstream{output, std::ios::binary | std::ios::trunc};
+			file.write(content.data(), static_cast<std::streamsize>(content.size()));
+			if (!file) throw ecole::scip::Exception{"Could not write file " + output};
+		}
+	} catch (ecole::scip::Exception const& e) {
+		std::cerr << e.what() << '\n';
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,18 @@
+import pytest
+
+import ecole.scip
+
+
+@pytest.mark.parametrize("capture", (False, True))
+@pytest.mark.benchmark(group="Solving log capture")
+@pytest.mark.slow
+def test_solve_log_capture(benchmark, model, capture):
+    """Overhead of capturing the solver log with respect to quiet mode."""
+
+    def setup():
+        model_copy = model.copy_orig()
+        if capture:
+            model_copy.enable_log_capture()
+        return (model_copy,), {}
+
+    benchmark.pedantic(ecole.scip.Model.solve, setup=setup, rounds=5)
@@ -0,0 +1,34 @@
+import pathlib
+import pickle
+import tempfile
+
+import pytest
+
+import ecole.scip
+
+
+def tmpfs_dir():
+    """A directory in memory backed storage if available."""
+    shm = pathlib.Path("/dev/shm")
+    return tempfile.TemporaryDirectory(dir=shm if shm.is_dir() else None)
+
+
+@pytest.mark.slow
+@pytest.mark.benchmark(group="Model serialization round trip")
+def test_pickle_round_trip(benchmark, model):
+    benchmark(lambda: pickle.loads(pickle.dumps(model, protocol=pickle.HIGHEST_PROTOCOL)))
+
+
+@pytest.mark.slow
+@pytest.mark.benchmark(group="Model serialization round trip")
+def test_mps_tmpfs_round_trip(benchmark, model):
+    with tmpfs_dir() as directory:
+        path = pathlib.Path(directory) / "model.mps"
+
+        def round_trip():
+            path.write_bytes(model.write_orig_prob_buffer("mps"))
+            copy = ecole.scip.Model.from_file(str(path))
+            copy.set_params(model.get_non_default_params())
+            return copy
+
+        benchmark(round_trip)
@@ -0,0 +1,24 @@
+import pytest
+
+import ecole.environment
+import ecole.instance
+
+
+@pytest.mark.slow
+@pytest.mark.parametrize("prefetch", (False, True))
+@pytest.mark.benchmark(group="Environment reset on new files")
+def test_reset_new_files(benchmark, problem_file, prefetch):
+    env = ecole.environment.Branching()
+    n_episodes = 10
+
+    def run_episodes():
+        instances = [problem_file] * n_episodes
+        if prefetch:
+            with ecole.instance.prefetch(instances, n_ahead=2) as prefetcher:
+                for _ in range(n_episodes):
+                    env.reset(prefetcher)
+        else:
+            for instance in instances:
+                env.reset(str(instance))
+
+    benchmark(run_episodes)
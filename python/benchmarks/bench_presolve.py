@@ -0,0 +1,16 @@
+import pytest
+
+import ecole.environment
+import ecole.scip
+
+
+@pytest.mark.slow
+@pytest.mark.parametrize("use_cache", (False, True))
+@pytest.mark.benchmark(group="Environment reset with presolve cache")
+def test_reset_presolve_cache(benchmark, problem_file, use_cache):
+    # Presolving must be enabled for the cache to save anything
+    model = ecole.scip.Model.from_file(str(problem_file))
+    cache = ecole.scip.PresolveCache() if use_cache else None
+    env = ecole.environment.Branching(presolve_cache=cache)
+    env.reset(model)
+    benchmark(env.reset, model)
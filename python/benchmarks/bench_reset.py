@@ -0,0 +1,21 @@
+import pytest
+
+import ecole.environment
+
+
+@pytest.mark.slow
+@pytest.mark.parametrize("reuse_model", (False, True))
+@pytest.mark.benchmark(group="Environment reset on the same instance")
+def test_reset_same_instance(benchmark, problem_file, reuse_model):
+    env = ecole.environment.Branching(reuse_model=reuse_model)
+    env.reset(str(problem_file))
+    benchmark(env.reset, str(problem_file))
+
+
+@pytest.mark.slow
+@pytest.mark.parametrize("reuse_model", (False, True))
+@pytest.mark.benchmark(group="Environment reset on the same Model")
+def test_reset_same_model(benchmark, model, reuse_model):
+    env = ecole.environment.Branching(reuse_model=reuse_model)
+    env.reset(model)
+    benchmark(env.reset, model)
@@ -0,0 +1,52 @@
+import numpy as np
+import pytest
+
+import ecole.scip
+
+
+def random_mps(n_vars, n_conss, n_nonzeros, seed=0):
+    """Write a random set covering like problem in (free) MPS format."""
+    rng = np.random.RandomState(seed)
+    rows = rng.randint(n_conss, size=n_nonzeros)
+    cols = rng.randint(n_vars, size=n_nonzeros)
+    lines = ["NAME random", "ROWS", " N obj"]
+    lines += [f" G c{i}" for i in range(n_conss)]
+    lines.append("COLUMNS")
+    # The entries of a column, including its objective, must be contiguous
+    order = np.argsort(cols, kind="stable")
+    starts = np.searchsorted(cols[order], np.arange(n_vars + 1))
+    for j in range(n_vars):
+        lines.append(f" x{j} obj 1")
+        for k in order[starts[j] : starts[j + 1]]:
+            lines.append(f" x{j} c{rows[k]} {rng.rand():.6f}")
+    lines.append("RHS")
+    lines += [f" rhs c{i} 1" for i in range(n_conss)]
+    lines.append("BOUNDS")
+    lines += [f" UP bnd x{j} 1" for j in range(n_vars)]
+    lines.append("ENDATA")
+    return "\n".join(lines).encode()
+
+
+@pytest.fixture(scope="module")
+def large_problem(tmp_path_factory):
+    """A problem with roughly one million non zeros, in MPS and snapshot format."""
+    directory = tmp_path_factory.mktemp("snapshot")
+    mps_file = directory / "large.mps"
+    mps_file.write_bytes(random_mps(n_vars=100_000, n_conss=50_000, n_nonzeros=1_000_000))
+    snap_file = directory / "large.snap"
+    ecole.scip.Model.from_file(str(mps_file)).write_snapshot_file(str(snap_file))
+    return mps_file, snap_file
+
+
+@pytest.mark.benchmark(group="Load 1e6 non zeros")
+@pytest.mark.slow
+def test_load_mps(benchmark, large_problem):
+    mps_file, _ = large_problem
+    benchmark.pedantic(ecole.scip.Model.from_file, args=(str(mps_file),), rounds=3)
+
+
+@pytest.mark.benchmark(group="Load 1e6 non zeros")
+@pytest.mark.slow
+def test_load_snapshot(benchmark, large_problem):
+    _, snap_file = large_problem
+    benchmark.pedantic(ecole.scip.Model.from_snapshot_file, args=(str(snap_file),), rounds=3)
@@ -0,0 +1,17 @@
+import pytest
+
+import ecole.scip
+
+
+@pytest.mark.parametrize("profile", ("full", "minimal-branching"))
+@pytest.mark.benchmark(group="Model startup")
+@pytest.mark.slow
+def test_create_model(benchmark, profile):
+    benchmark(ecole.scip.Model, profile)
+
+
+@pytest.mark.parametrize("profile", ("full", "minimal-branching"))
+@pytest.mark.benchmark(group="Model startup from file")
+@pytest.mark.slow
+def test_create_model_from_file(benchmark, problem_file, profile):
+    benchmark(ecole.scip.Model.from_file, str(problem_file), profile)
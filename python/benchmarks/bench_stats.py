@@ -0,0 +1,9 @@
+import pytest
+
+
+@pytest.mark.slow
+@pytest.mark.benchmark(group="Solver statistics")
+def test_stats(benchmark, model):
+    """Cost of a statistics snapshot on a solved model."""
+    model.solve()
+    benchmark(model.stats)
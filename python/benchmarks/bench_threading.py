@@ -4,6 +4,7 @@ import pytest
 
 import ecole.environment
 import ecole.observation
+import ecole.scip
 
 
 # FIXME set seed.
@@ -51,3 +52,34 @@ def test_solve_mulithread(benchmark, model, n_threads):
             t.join()
 
     benchmark.pedantic(run_threads, setup=setup_threads, rounds=5)
+
+
+def reset_environment(problem_file, n_resets):
+    env = ecole.environment.Branching(observation_function=ecole.observation.Nothing())
+    for _ in range(n_resets):
+        env.reset(ecole.scip.Model.from_file(problem_file))
+
+
+@pytest.mark.parametrize("n_threads", (1, 2, 4, 8))
+@pytest.mark.benchmark(group="Branching reset")
+@pytest.mark.slow
+def test_reset_multithread(benchmark, problem_file, n_threads):
+    """Total time of a fixed number of resets, shared among threads.
+
+    With the GIL released in reading, parameter setting, and dynamics, the time should
+    decrease with the number of threads (up to the number of cores).
+    """
+    n_resets = 8
+
+    def setup_threads():
+        args = (str(problem_file), n_resets // n_threads)
+        threads = [threading.Thread(target=reset_environment, args=args) for _ in range(n_threads)]
+        return (threads,), {}
+
+    def run_threads(threads):
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+    benchmark.pedantic(run_threads, setup=setup_threads, rounds=5)
@@ -0,0 +1,32 @@
+import pytest
+
+import ecole.environment
+import ecole.observation
+import ecole.vector
+
+
+def make_environment():
+    return ecole.environment.Branching(observation_function=ecole.observation.NodeBipartite())
+
+
+@pytest.mark.parametrize("n_environments", (1, 2, 4, 8))
+@pytest.mark.benchmark(group="Vector environment")
+@pytest.mark.slow
+def test_vector_trajectories(benchmark, problem_file, n_environments):
+    """Time to run one full trajectory per worker process, reading observations in place."""
+    obs, _, _, _ = make_environment().reset(str(problem_file))
+    layout = ecole.vector.SlotLayout.from_observation(obs)
+
+    with ecole.vector.VectorEnvironment(make_environment, n_environments, layout) as vec_env:
+
+        def run_trajectories():
+            transitions = vec_env.reset([str(problem_file)] * n_environments)
+            action_sets = [action_set for _, action_set, _, done in transitions]
+            dones = [done for _, _, _, done in transitions]
+            while not all(dones):
+                actions = [None if done else a[0] for a, done in zip(action_sets, dones)]
+                for i, transition in enumerate(vec_env.step(actions)):
+                    if transition is not None:
+                        _, action_sets[i], _, dones[i], _ = transition
+
+        benchmark.pedantic(run_trajectories, rounds=3)
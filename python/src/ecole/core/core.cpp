@@ -17,5 +17,6 @@ PYBIND11_MODULE(core, m) {
 	ecole::scip::bind_submodule(m.def_submodule("scip"));
 	ecole::observation::bind_submodule(m.def_submodule("observation"));
 	ecole::reward::bind_submodule(m.def_submodule("reward"));
+	ecole::instance::bind_submodule(m.def_submodule("instance"));
 	ecole::environment::bind_submodule(m.def_submodule("environment"));
 }
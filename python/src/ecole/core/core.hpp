@@ -18,6 +18,10 @@ namespace reward {
 void bind_submodule(pybind11::module);
 }
 
+namespace instance {
+void bind_submodule(pybind11::module);
+}
+
 namespace environment {
 void bind_submodule(pybind11::module);
 }
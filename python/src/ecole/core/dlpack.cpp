@@ -0,0 +1,79 @@
+#include <stdexcept>
+
+#include <pybind11/stl.h>
+
+#include "dlpack.hpp"
+
+namespace ecole {
+namespace dlpack {
+
+namespace {
+
+constexpr auto capsule_name = "dltensor";
+
+/**
+ * Free the tensor if the capsule was never consumed.
+ *
+ * Consumers rename the capsule "used_dltensor" and become responsible for calling the deleter.
+ */
+void delete_unused_capsule(PyObject* capsule) noexcept {
+	if (PyCapsule_IsValid(capsule, capsule_name) != 0) {
+		auto* const managed =
+			static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule, capsule_name));
+		managed->deleter(managed);
+	}
+}
+
+/**
+ * Release the reference to the Python owner of a shared buffer.
+ *
+ * Consumers may delete the tensor from any thread, without holding the GIL.
+ */
+void release_owner(void* owner) noexcept {
+	if (Py_IsInitialized() == 0) return;
+	py::gil_scoped_acquire const gil{};
+	Py_DECREF(static_cast<PyObject*>(owner));
+}
+
+}  // namespace
+
+std::vector<std::int64_t> const& DLPackTensor::shape() const {
+	if (consumed()) throw std::runtime_error("DLPack tensor was already consumed");
+	return context->shape;
+}
+
+py::capsule DLPackTensor::dlpack() {
+	if (consumed()) throw std::runtime_error("DLPack tensor was already consumed");
+	auto capsule = py::capsule{&context->managed, capsule_name, &delete_unused_capsule};
+	// The capsule (or the consumer) now owns the buffer
+	context.release();
+	return capsule;
+}
+
+std::shared_ptr<void> DLPackTensor::share_owner(py::object owner) {
+	return {owner.release().ptr(), &release_owner};
+}
+
+void DLPackTensor::delete_context(DLManagedTensor* self) noexcept {
+	delete static_cast<Context*>(self->manager_ctx);
+}
+
+void bind_dlpack_tensor(py::module& m) {
+	py::class_<DLPackTensor>(m, "DLPackTensor", R"(
+		A C++ tensor exported with the DLPack protocol.
+
+		Frameworks adopt the buffer without copy, e.g. with ``torch.from_dlpack`` or
+		``numpy.from_dlpack``.
+		The buffer ownership (or a share of it) is transfered on the first conversion, after which
+		the tensor cannot be used anymore.
+	)")
+		.def_property_readonly("consumed", &DLPackTensor::consumed)
+		.def_property_readonly("shape", [](DLPackTensor const& self) {
+			return py::tuple{py::cast(self.shape())};
+		})
+		.def("__dlpack__", &DLPackTensor::dlpack, py::arg("stream") = py::none())
+		.def_static("__dlpack_device__", &DLPackTensor::dlpack_device);
+}
+
+}  // namespace dlpack
+}  // namespace ecole
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <xtensor/xtensor.hpp>
+
+namespace ecole {
+namespace dlpack {
+
+namespace py = pybind11;
+
+/**
+ * Structures of the DLPack C ABI (version 0.x).
+ *
+ * Only the subset needed to export CPU tensors is declared, with the layout of `dlpack.h`.
+ */
+enum DLDeviceType : std::int32_t { kDLCPU = 1 };
+
+enum DLDataTypeCode : std::uint8_t { kDLInt = 0U, kDLUInt = 1U, kDLFloat = 2U };
+
+struct DLDevice {
+	std::int32_t device_type;
+	std::int32_t device_id;
+};
+
+struct DLDataType {
+	std::uint8_t code;
+	std::uint8_t bits;
+	std::uint16_t lanes;
+};
+
+struct DLTensor {
+	void* data;
+	DLDevice device;
+	std::int32_t ndim;
+	DLDataType dtype;
+	std::int64_t* shape;
+	std::int64_t* strides;
+	std::uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+	DLTensor dl_tensor;
+	void* manager_ctx;
+	void (*deleter)(DLManagedTensor* self);
+};
+
+/**
+ * DLPack type code of an arithmetic type.
+ *
+ * Unsigned 64 bits integers (the indices of sparse matrices) are exported as signed, as most
+ * frameworks do not support unsigned indices, and they never exceed the signed range.
+ */
+template <typename T> constexpr DLDataType data_type() noexcept {
+	static_assert(std::is_arithmetic<T>::value, "DLPack tensors must hold arithmetic types");
+	auto code = std::uint8_t{kDLInt};
+	if (std::is_floating_point<T>::value) {
+		code = kDLFloat;
+	} else if (std::is_unsigned<T>::value && sizeof(T) < 8) {
+		code = kDLUInt;
+	}
+	return {code, static_cast<std::uint8_t>(8 * sizeof(T)), 1U};
+}
+
+/**
+ * Owner of a tensor buffer and of the metadata pointed to by its DLManagedTensor.
+ */
+struct Context {
+	std::shared_ptr<void> buffer;
+	std::vector<std::int64_t> shape;
+	std::vector<std::int64_t> strides;
+	DLManagedTensor managed;
+};
+
+/**
+ * A tensor exported through the DLPack protocol.
+ *
+ * The xtensor buffer is either moved in, or shared with the Python object owning it, which is
+ * then kept alive by the tensor; both without copy.
+ * Ownership is transfered to the consumer (PyTorch, JAX, CuPy, NumPy...) on the first call to
+ * `__dlpack__`, after which the tensor is empty.
+ */
+class DLPackTensor {
+public:
+	template <typename T, std::size_t N> explicit DLPackTensor(xt::xtensor<T, N>&& tensor) {
+		auto buffer = std::make_shared<xt::xtensor<T, N>>(std::move(tensor));
+		set_tensor(*buffer);
+		context->buffer = std::move(buffer);
+	}
+
+	/**
+	 * Share the buffer of a tensor held by a Python object, such as an observation.
+	 *
+	 * The buffer must live as long as its owner.
+	 */
+	template <typename T, std::size_t N>
+	DLPackTensor(xt::xtensor<T, N> const& tensor, py::object owner) {
+		set_tensor(tensor);
+		context->buffer = share_owner(std::move(owner));
+	}
+
+	/** Whether the buffer was already given to a consumer. */
+	bool consumed() const noexcept { return context == nullptr; }
+
+	/** Shape of the tensor, if not yet consumed. */
+	std::vector<std::int64_t> const& shape() const;
+
+	/** Give the buffer to the consumer in a PyCapsule named "dltensor". */
+	py::capsule dlpack();
+
+	/** The device of the tensor, always the CPU. */
+	static std::pair<std::int32_t, std::int32_t> dlpack_device() noexcept { return {kDLCPU, 0}; }
+
+private:
+	std::unique_ptr<Context> context;
+
+	template <typename T, std::size_t N> void set_tensor(xt::xtensor<T, N> const& tensor) {
+		context = std::unique_ptr<Context>{new Context{}};
+		context->shape = {tensor.shape().begin(), tensor.shape().end()};
+		// Row major strides in number of elements, recomputed because xtensor uses zero strides
+		// for dimensions of size one.
+		context->strides.resize(N);
+		auto stride = std::int64_t{1};
+		for (auto i = N; i > 0; --i) {
+			context->strides[i - 1] = stride;
+			stride *= context->shape[i - 1];
+		}
+		auto& dl_tensor = context->managed.dl_tensor;
+		dl_tensor.data = const_cast<T*>(tensor.data());  // NOLINT DLPack has no const data
+		dl_tensor.device = {kDLCPU, 0};
+		dl_tensor.ndim = static_cast<std::int32_t>(N);
+		dl_tensor.dtype = data_type<T>();
+		dl_tensor.shape = context->shape.data();
+		dl_tensor.strides = context->strides.data();
+		dl_tensor.byte_offset = 0;
+		context->managed.manager_ctx = context.get();
+		context->managed.deleter = &delete_context;
+	}
+
+	/** A reference to the Python owner of a buffer, released with the GIL. */
+	static std::shared_ptr<void> share_owner(py::object owner);
+	static void delete_context(DLManagedTensor* self) noexcept;
+};
+
+/**
+ * Bind the DLPackTensor class in the given module.
+ */
+void bind_dlpack_tensor(py::module& m);
+
+}  // namespace dlpack
+}  // namespace ecole
@@ -1,18 +1,32 @@
+#include <chrono>
 #include <limits>
+#include <map>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <utility>
 
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <xtensor-python/pytensor.hpp>
 
+#include "ecole/environment/abstract.hpp"
 #include "ecole/environment/branching-dynamics.hpp"
 #include "ecole/environment/configuring-dynamics.hpp"
+#include "ecole/environment/default.hpp"
+#include "ecole/environment/episode-model.hpp"
 #include "ecole/environment/exception.hpp"
+#include "ecole/environment/memory.hpp"
+#include "ecole/instance/prefetcher.hpp"
+#include "ecole/observation/nodebipartite.hpp"
+#include "ecole/observation/nothing.hpp"
+#include "ecole/observation/strongbranchingscores.hpp"
 #include "ecole/scip/model.hpp"
+#include "ecole/scip/presolve-cache.hpp"
 
 #include "core.hpp"
+#include "reward.hpp"
 
 namespace ecole {
 namespace environment {
@@ -36,7 +50,134 @@ template <typename Dynamics> auto dynamics_class(py::module& m, char const* name
 			"set_dynamics_random_state",
 			&Dynamics::set_dynamics_random_state,
 			py::arg("model"),
-			py::arg("random_engine"));
+			py::arg("random_engine"),
+			py::call_guard<py::gil_scoped_release>());
+}
+
+/**
+ * Convert the information of a transition to the dictionary used by Python environments.
+ */
+static py::dict info_as_dict(Info const& info) {
+	auto dict = py::dict{};
+	dict["done_reason"] = info.done_reason;
+	dict["memory"] = info.memory;
+	dict["observation_memory"] = info.observation_memory;
+	auto const seconds = [](std::chrono::nanoseconds duration) {
+		return std::chrono::duration<double>{duration}.count();
+	};
+	auto timings = py::dict{};
+	timings["dynamics"] = seconds(info.timings.dynamics);
+	timings["solver"] = seconds(info.timings.solver);
+	timings["handoff"] = seconds(info.timings.handoff);
+	timings["observation"] = seconds(info.timings.observation);
+	timings["reward"] = seconds(info.timings.reward);
+	dict["timings"] = std::move(timings);
+	dict["n_nodes"] = info.n_nodes;
+	dict["n_lp_iterations"] = info.n_lp_iterations;
+	return dict;
+}
+
+/**
+ * Bind the options used to start episodes, shared by environments and the EpisodeModel.
+ */
+template <typename Class> void def_episode_options(Class& cls) {
+	using T = typename Class::type;
+	cls.def_property(
+			 "scip_params",
+			 [](T& self) { return self.scip_params(); },
+			 [](T& self, std::map<std::string, scip::Param> params) {
+				 self.scip_params() = std::move(params);
+			 })
+		.def_property(
+			"memory_budget",
+			[](T& self) { return self.memory_budget(); },
+			[](T& self, std::size_t budget) { self.memory_budget() = budget; })
+		.def_property(
+			"root_basis_cache",
+			[](T& self) { return self.root_basis_cache(); },
+			[](T& self, std::shared_ptr<scip::RootBasisCache> cache) {
+				self.root_basis_cache() = std::move(cache);
+			})
+		.def_property(
+			"reuse_model",
+			[](T& self) { return self.reuse_model(); },
+			[](T& self, bool reuse) { self.reuse_model() = reuse; })
+		.def_property(
+			"presolve_cache",
+			[](T& self) { return self.presolve_cache(); },
+			[](T& self, std::shared_ptr<scip::PresolveCache> cache) {
+				self.presolve_cache() = std::move(cache);
+			})
+		.def_property_readonly("presolved_problem", [](T const& self) {
+			return std::const_pointer_cast<scip::PresolvedProblem>(self.presolved_problem());
+		});
+}
+
+/**
+ * Bind an environment with native dynamics and observation function.
+ *
+ * The reward function can be any, but reward functions defined in Python need the GIL.
+ * A full transition is a single call with the GIL released.
+ */
+template <typename Dynamics, typename ObservationFunction>
+void environment_class(py::module& m, char const* name) {
+	using Env = EnvironmentComposer<Dynamics, ObservationFunction, reward::SharedRewardFunction>;
+	using Action = typename Env::Action;
+
+	auto env_class = py::class_<Env>(m, name);
+	env_class  //
+		.def(
+			py::init([](
+								 ObservationFunction obs_func,
+								 py::object const& reward_func,
+								 std::map<std::string, scip::Param> scip_params,
+								 Dynamics const& dynamics) {
+				return std::make_unique<Env>(
+					std::move(obs_func),
+					reward::as_reward_function(reward_func),
+					std::move(scip_params),
+					dynamics);
+			}),
+			py::arg("observation_function"),
+			py::arg("reward_function"),
+			py::arg("scip_params"),
+			py::arg("dynamics"))
+		.def(
+			"reset",
+			[](Env& env, scip::Model const& model) { return env.reset(model); },
+			py::arg("instance"),
+			py::call_guard<py::gil_scoped_release>())
+		.def(
+			"reset",
+			[](Env& env, std::string const& filename) { return env.reset(filename); },
+			py::arg("instance"),
+			py::call_guard<py::gil_scoped_release>())
+		.def(
+			"reset",
+			[](Env& env, instance::InstancePrefetcher& prefetcher) { return env.reset(prefetcher); },
+			py::arg("instance"),
+			py::call_guard<py::gil_scoped_release>())
+		.def(
+			"step",
+			[](Env& env, Action const& action) {
+				auto transition = [&] {
+					py::gil_scoped_release release{};
+					return env.step(action);
+				}();
+				return py::make_tuple(
+					std::move(std::get<0>(transition)),
+					std::move(std::get<1>(transition)),
+					std::get<2>(transition),
+					std::get<3>(transition),
+					info_as_dict(std::get<4>(transition)));
+			},
+			py::arg("action"))
+		.def("seed", &Env::seed, py::arg("value"))
+		.def_property_readonly(
+			"model",
+			[](Env& env) -> scip::Model& { return env.model(); },
+			py::return_value_policy::reference_internal);
+	def_episode_options(env_class);
 }
 
 void bind_submodule(pybind11::module m) {
@@ -44,6 +185,34 @@ void bind_submodule(pybind11::module m) {
 
 	py::register_exception<Exception>(m, "Exception");
 
+	py::enum_<DoneReason>(m, "DoneReason", "Why an episode ended.")
+		.value("NotDone", DoneReason::NotDone)
+		.value("Finished", DoneReason::Finished)
+		.value("MemoryLimit", DoneReason::MemoryLimit);
+
+	m.def(
+		"set_memory_limit",
+		&set_memory_limit,
+		py::arg("model"),
+		py::arg("budget"),
+		py::call_guard<py::gil_scoped_release>(),
+		"Lower the SCIP memory limit so that the solver stops by itself within the budget.");
+	m.def(
+		"exceeds_memory_budget",
+		&exceeds_memory_budget,
+		py::arg("model"),
+		py::arg("budget"),
+		py::call_guard<py::gil_scoped_release>(),
+		"Whether the memory used by the model exceeds the budget (in bytes).");
+	m.def(
+		"done_reason",
+		&done_reason,
+		py::arg("model"),
+		py::arg("done"),
+		py::arg("memory_exceeded"),
+		py::call_guard<py::gil_scoped_release>(),
+		"Find why an episode ended.");
+
 	py::class_<RandomEngine>(m, "RandomEngine")  //
 		.def_property_readonly_static(
 			"min_seed",
@@ -64,11 +233,51 @@ void bind_submodule(pybind11::module m) {
 		.def(py::self == py::self)
 		.def(py::self != py::self);
 
+	auto episode_class = py::class_<EpisodeModel>(m, "EpisodeModel", R"(
+		The model of the episodes of an environment, and the options used to start them.
+
+		Used by environments with dynamics or observation functions defined in Python, so that
+		they start their episodes as the native environments.
+	)");
+	episode_class  //
+		.def(py::init<>())
+		.def(
+			"reset",
+			[](EpisodeModel& self, scip::Model const& model) { self.reset(model); },
+			py::arg("instance"),
+			py::call_guard<py::gil_scoped_release>(),
+			"Start an episode on a copy of the model.")
+		.def(
+			"reset",
+			[](EpisodeModel& self, std::string const& filename) { self.reset(filename); },
+			py::arg("instance"),
+			py::call_guard<py::gil_scoped_release>(),
+			"Start an episode on the problem read from a file.")
+		.def(
+			"reset",
+			[](EpisodeModel& self, instance::InstancePrefetcher& prefetcher) { self.reset(prefetcher); },
+			py::arg("instance"),
+			py::call_guard<py::gil_scoped_release>(),
+			"Start an episode on the next instance of a prefetcher.")
+		.def_property_readonly(
+			"model",
+			[](EpisodeModel& self) -> scip::Model& { return self.model(); },
+			py::return_value_policy::reference_internal);
+	def_episode_options(episode_class);
+
 	dynamics_class<BranchingDynamics>(m, "BranchingDynamics")  //
 		.def(py::init<bool>(), py::arg("pseudo_candidates") = false);
 
 	dynamics_class<ConfiguringDynamics>(m, "ConfiguringDynamics")  //
 		.def(py::init<>());
+
+	environment_class<BranchingDynamics, observation::NodeBipartite>(m, "BranchingNodeBipartite");
+	environment_class<BranchingDynamics, observation::StrongBranchingScores>(
+		m, "BranchingStrongBranchingScores");
+	environment_class<BranchingDynamics, observation::Nothing>(m, "BranchingNothing");
+	environment_class<ConfiguringDynamics, observation::NodeBipartite>(
+		m, "ConfiguringNodeBipartite");
+	environment_class<ConfiguringDynamics, observation::Nothing>(m, "ConfiguringNothing");
 }
 
 }  // namespace environment
@@ -0,0 +1,165 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "ecole/instance/prefetcher.hpp"
+#include "ecole/instance/source.hpp"
+#include "ecole/scip/model.hpp"
+#include "ecole/scip/plugins.hpp"
+
+#include "core.hpp"
+
+namespace ecole {
+namespace instance {
+
+namespace py = pybind11;
+
+/**
+ * Destroy the prefetcher without the GIL, as its thread may be waiting for it.
+ */
+struct ReleaseGilDeleter {
+	void operator()(InstancePrefetcher* prefetcher) const {
+		py::gil_scoped_release release{};
+		delete prefetcher;
+	}
+};
+
+/**
+ * Share a Python object among threads that may not hold the GIL when releasing it.
+ */
+static std::shared_ptr<py::object> share_object(py::object obj) {
+	auto const delete_with_gil = [](py::object* ptr) {
+		py::gil_scoped_acquire gil{};
+		delete ptr;
+	};
+	return {new py::object{std::move(obj)}, delete_with_gil};
+}
+
+/**
+ * Instances of a Python iterable of Models or file paths, taken from the prefetcher thread.
+ *
+ * Models are copied, as they remain owned by Python, and files are read without the GIL.
+ * Errors raised by the iterable are raised unchanged when the instance is taken.
+ */
+static GeneratorSource::Generator
+make_generator(py::iterable const& iterable, scip::PluginProfile profile) {
+	auto iterator = share_object(py::iter(iterable));
+	return [iterator, profile]() -> nonstd::optional<scip::Model> {
+		auto filename = std::string{};
+		{
+			py::gil_scoped_acquire gil{};
+			auto item = py::reinterpret_steal<py::object>(PyIter_Next(iterator->ptr()));
+			if (!item) {
+				if (PyErr_Occurred() == nullptr) return {};
+				// Keep the Python exception, raised again when the instance is taken
+				throw py::error_already_set{};
+			}
+			if (py::isinstance<scip::Model>(item)) {
+				auto const& model = item.cast<scip::Model const&>();
+				py::gil_scoped_release release{};
+				return model.copy_orig();
+			}
+			filename = py::str(item).cast<std::string>();
+		}
+		return scip::Model::from_file(filename, profile);
+	};
+}
+
+void bind_submodule(py::module m) {
+	m.doc() = "Sources of problem instances, and their prefetching.";
+
+	py::class_<InstanceSource, std::shared_ptr<InstanceSource>>(
+		m, "InstanceSource", "A sequence of problem instances, read or generated on demand.");
+
+	py::class_<FileSource, InstanceSource, std::shared_ptr<FileSource>>(
+		m, "FileSource", "Instances read from a list of files.")
+		.def(
+			py::init([](std::vector<std::string> filenames, bool cycle, std::string const& profile) {
+				return std::make_shared<FileSource>(
+					std::move(filenames), cycle, scip::plugin_profile_from_string(profile));
+			}),
+			py::arg("filenames"),
+			py::arg("cycle") = false,
+			py::arg("profile") = "full",
+			"Read the files in order, cycling back to the first one at the end if requested.")
+		.def_static(
+			"from_glob",
+			[](std::string const& pattern, bool cycle, std::string const& profile) {
+				return std::make_shared<FileSource>(
+					FileSource::from_glob(pattern, cycle, scip::plugin_profile_from_string(profile)));
+			},
+			py::arg("pattern"),
+			py::arg("cycle") = false,
+			py::arg("profile") = "full",
+			"Files matching a shell pattern, in alphabetical order.")
+		.def_property_readonly("filenames", &FileSource::filenames);
+
+	py::class_<GeneratorSource, InstanceSource, std::shared_ptr<GeneratorSource>>(
+		m, "GeneratorSource", "Instances taken from a Python iterable of Models or file paths.")
+		.def(
+			py::init([](py::iterable const& iterable, std::string const& profile) {
+				return std::make_shared<GeneratorSource>(
+					make_generator(iterable, scip::plugin_profile_from_string(profile)));
+			}),
+			py::arg("iterable"),
+			py::arg("profile") = "full");
+
+	auto const seconds = [](std::chrono::nanoseconds duration) {
+		return std::chrono::duration<double>{duration}.count();
+	};
+	py::class_<PrefetchStats>(m, "PrefetchStats", "Statistics of an InstancePrefetcher.")
+		.def_readonly("n_instances", &PrefetchStats::n_instances)
+		.def_readonly(
+			"n_stalls", &PrefetchStats::n_stalls, "Number of instances not ready when requested.")
+		.def_property_readonly(
+			"stall_time",
+			[seconds](PrefetchStats const& stats) { return seconds(stats.stall_time); },
+			"Seconds spent waiting for instances that were not ready.")
+		.def_property_readonly(
+			"load_time",
+			[seconds](PrefetchStats const& stats) { return seconds(stats.load_time); },
+			"Seconds spent in the background reading or generating instances.")
+		.def_readonly("n_ready", &PrefetchStats::n_ready)
+		.def_readonly("ready_memory", &PrefetchStats::ready_memory);
+
+	py::class_<InstancePrefetcher, std::unique_ptr<InstancePrefetcher, ReleaseGilDeleter>>(
+		m, "InstancePrefetcher", R"(
+			Read or generate instances ahead of time in a background thread.
+
+			Up to ``n_ahead`` instances are kept ready, as Models on which environments reset
+			without parsing nor copying the instance.
+			With a non zero ``memory_budget`` (in bytes), no further instance is loaded while the
+			ready instances use more solver memory than the budget.
+		)")
+		.def(
+			py::init<std::shared_ptr<InstanceSource>, std::size_t, std::size_t>(),
+			py::arg("source"),
+			py::arg("n_ahead") = 2,
+			py::arg("memory_budget") = 0)
+		.def("__iter__", [](py::object const& self) { return self; })
+		.def("__next__", [](InstancePrefetcher& self) {
+			auto model = [&self] {
+				py::gil_scoped_release release{};
+				return self.next();
+			}();
+			if (!model) throw py::stop_iteration{};
+			return std::move(*model);
+		})
+		.def("close", &InstancePrefetcher::close, py::call_guard<py::gil_scoped_release>())
+		.def("stats", &InstancePrefetcher::stats, py::call_guard<py::gil_scoped_release>())
+		.def("__enter__", [](py::object const& self) { return self; })
+		.def(
+			"__exit__",
+			[](InstancePrefetcher& self, py::args const& /*args*/) {
+				py::gil_scoped_release release{};
+				self.close();
+			});
+}
+
+}  // namespace instance
+}  // namespace ecole
@@ -1,17 +1,29 @@
+#include <array>
+#include <cstddef>
+#include <cstring>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include <nonstd/variant.hpp>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <xtensor-python/pytensor.hpp>
 
+#include "ecole/none.hpp"
+#include "ecole/observation/dict.hpp"
 #include "ecole/observation/nodebipartite.hpp"
 #include "ecole/observation/nothing.hpp"
 #include "ecole/observation/strongbranchingscores.hpp"
 #include "ecole/scip/model.hpp"
+#include "ecole/traits.hpp"
 #include "ecole/utility/sparse_matrix.hpp"
 
 #include "core.hpp"
+#include "dlpack.hpp"
 
 namespace ecole {
 namespace observation {
@@ -43,6 +55,152 @@ auto def_obtain_observation(PyClass pyclass, Args&&... args) {
 		std::forward<Args>(args)...);
 }
 
+/**
+ * A DLPack tensor sharing a tensor buffer, keeping its owner alive.
+ */
+template <typename T, std::size_t N>
+dlpack::DLPackTensor dlpack_view(xt::xtensor<T, N> const& tensor, py::handle owner) {
+	return {tensor, py::reinterpret_borrow<py::object>(owner)};
+}
+
+/**
+ * A NumPy view on a tensor buffer, keeping its owner alive.
+ */
+template <typename T, std::size_t N>
+py::array_t<T> array_view(xt::xtensor<T, N> const& tensor, py::handle owner) {
+	auto shape = std::vector<std::size_t>{tensor.shape().begin(), tensor.shape().end()};
+	return {std::move(shape), tensor.data(), owner};
+}
+
+/**
+ * Wrap a tensor buffer for pickling.
+ *
+ * With protocol 5, the buffer is given as a ``PickleBuffer`` so that it can be transfered out of
+ * band without copy, otherwise the NumPy view is pickled in band.
+ */
+template <typename T, std::size_t N>
+py::object pickle_buffer(xt::xtensor<T, N> const& tensor, py::handle owner, int protocol) {
+	auto array = array_view(tensor, owner);
+	if (protocol >= 5) return py::module::import("pickle").attr("PickleBuffer")(std::move(array));
+	return std::move(array);
+}
+
+/**
+ * Copy a C-contiguous buffer of the given shape into a tensor.
+ */
+template <typename T, std::size_t N>
+xt::xtensor<T, N> tensor_from_buffer(py::handle buffer, std::array<std::size_t, N> const& shape) {
+	auto const info = buffer.cast<py::buffer>().request();
+	auto tensor = xt::xtensor<T, N>::from_shape(shape);
+	auto stride = info.itemsize;
+	for (auto i = info.ndim; i > 0; --i) {
+		if ((info.shape[i - 1] > 1) && (info.strides[i - 1] != stride)) {
+			throw std::invalid_argument("Buffer must be contiguous");
+		}
+		stride *= info.shape[i - 1];
+	}
+	auto const n_bytes = static_cast<std::size_t>(info.size * info.itemsize);
+	if (n_bytes != tensor.size() * sizeof(T)) {
+		throw std::invalid_argument("Buffer size does not match the tensor shape");
+	}
+	std::memcpy(tensor.data(), info.ptr, n_bytes);
+	return tensor;
+}
+
+/**
+ * Protocol used when the state is requested through ``__getstate__``.
+ */
+constexpr auto pickle_default_protocol = 4;
+
+/**
+ * Build the ``__reduce_ex__`` value of an object restored from its state by ``__setstate__``.
+ */
+static py::tuple reduce_with_state(py::object const& self, py::tuple state) {
+	auto const newobj = py::module::import("copyreg").attr("__newobj__");
+	return py::make_tuple(newobj, py::make_tuple(self.get_type()), std::move(state));
+}
+
+using coo_matrix = decltype(NodeBipartiteObs::edge_features);
+
+/**
+ * Pickle state of a sparse matrix: its buffers and its dense shape.
+ */
+static py::tuple coo_matrix_state(py::object const& self, int protocol) {
+	auto const& matrix = self.cast<coo_matrix const&>();
+	return py::make_tuple(
+		pickle_buffer(matrix.values, self, protocol),
+		pickle_buffer(matrix.indices, self, protocol),
+		matrix.shape);
+}
+
+static coo_matrix coo_matrix_from_state(py::tuple const& state) {
+	if (state.size() != 3) throw std::runtime_error("Invalid coo_matrix state");
+	auto const values_info = state[0].cast<py::buffer>().request();
+	auto const n_bytes = static_cast<std::size_t>(values_info.size * values_info.itemsize);
+	auto const nnz = n_bytes / sizeof(coo_matrix::value_type);
+	return {
+		tensor_from_buffer<coo_matrix::value_type, 1>(state[0], {nnz}),
+		tensor_from_buffer<std::size_t, 2>(state[1], {2, nnz}),
+		state[2].cast<std::array<std::size_t, 2>>()};
+}
+
+/**
+ * Pickle state of a bipartite observation: its buffers, their shape, and the edge matrix.
+ */
+static py::tuple node_bipartite_obs_state(py::object const& self, int protocol) {
+	auto const& obs = self.cast<NodeBipartiteObs const&>();
+	return py::make_tuple(
+		pickle_buffer(obs.column_features, self, protocol),
+		obs.column_features.shape(),
+		pickle_buffer(obs.row_features, self, protocol),
+		obs.row_features.shape(),
+		py::cast(obs.edge_features, py::return_value_policy::reference_internal, self));
+}
+
+static NodeBipartiteObs node_bipartite_obs_from_state(py::tuple const& state) {
+	if (state.size() != 5) throw std::runtime_error("Invalid NodeBipartiteObs state");
+	using value_type = NodeBipartiteObs::value_type;
+	return {
+		tensor_from_buffer<value_type, 2>(state[0], state[1].cast<std::array<std::size_t, 2>>()),
+		tensor_from_buffer<value_type, 2>(state[2], state[3].cast<std::array<std::size_t, 2>>()),
+		std::move(state[4].cast<coo_matrix&>())};
+}
+
+/**
+ * Observation of any native observation function, used to compose them at runtime.
+ */
+using AnyObservation = nonstd::variant<
+	NoneType,
+	NodeBipartite::Observation,
+	trait::observation_of_t<StrongBranchingScores>>;
+
+using NativeDictFunction = DictFunction<AnyObservation>;
+
+template <typename Function>
+bool insert_if_instance(NativeDictFunction& dict_func, std::string name, py::handle func) {
+	if (!py::isinstance<Function>(func)) return false;
+	dict_func.insert_adapted(std::move(name), func.cast<std::shared_ptr<Function>>());
+	return true;
+}
+
+/**
+ * Compose native observation functions, sharing them with Python.
+ */
+static NativeDictFunction make_native_dict_function(py::dict const& functions) {
+	auto dict_func = NativeDictFunction{};
+	for (auto const& name_func : functions) {
+		auto name = name_func.first.cast<std::string>();
+		auto const func = name_func.second;
+		if (
+			!insert_if_instance<NodeBipartite>(dict_func, name, func) &&
+			!insert_if_instance<StrongBranchingScores>(dict_func, name, func) &&
+			!insert_if_instance<Nothing>(dict_func, name, func)) {
+			throw py::type_error("Observation function " + name + " is not a native function");
+		}
+	}
+	return dict_func;
+}
+
 /**
  * Observation module bindings definitions.
  */
@@ -51,7 +209,9 @@ void bind_submodule(py::module m) {
 
 	xt::import_numpy();
 
-	auto nothing = py::class_<Nothing>(m, "Nothing", R"(
+	dlpack::bind_dlpack_tensor(m);
+
+	auto nothing = py::class_<Nothing, std::shared_ptr<Nothing>>(m, "Nothing", R"(
 		No observation.
 
 		This observation function does nothing and always returns ``None`` as an observation.
@@ -61,7 +221,6 @@ void bind_submodule(py::module m) {
 	def_reset(nothing, R"(Do nothing.)");
 	def_obtain_observation(nothing, R"(Return None.)");
 
-	using coo_matrix = decltype(NodeBipartiteObs::edge_features);
 	py::class_<coo_matrix>(m, "coo_matrix", R"(
 		Sparse matrix in the coordinate format.
 
@@ -81,7 +240,29 @@ void bind_submodule(py::module m) {
 			"shape",
 			[](coo_matrix& self) { return std::make_pair(self.shape[0], self.shape[1]); },
 			"The dimension of the sparse matrix, as if it was dense.")
-		.def_property_readonly("nnz", &coo_matrix::nnz);
+		.def_property_readonly("nnz", &coo_matrix::nnz)
+		.def(py::pickle(
+			[](py::object const& self) { return coo_matrix_state(self, pickle_default_protocol); },
+			&coo_matrix_from_state))
+		.def(
+			"__reduce_ex__",
+			[](py::object const& self, int protocol) {
+				return reduce_with_state(self, coo_matrix_state(self, protocol));
+			},
+			py::arg("protocol"),
+			"Pickle the matrix, with out of band buffers from protocol 5.")
+		.def(
+			"to_dlpack",
+			[](py::object const& self) {
+				auto const& matrix = self.cast<coo_matrix const&>();
+				return std::make_pair(dlpack_view(matrix.values, self), dlpack_view(matrix.indices, self));
+			},
+			"Share the values and indices buffers as DLPack tensors, without copy. "
+			"The tensors keep the matrix alive, and see its changes.")
+		.def_property_readonly(
+			"nbytes",
+			[](coo_matrix const& self) { return buffer_size(self); },
+			"Number of bytes held in the matrix buffers.");
 
 	py::class_<NodeBipartiteObs>(m, "NodeBipartiteObs", R"(
 		Bipartite graph observation for branch-and-bound nodes.
@@ -109,9 +290,45 @@ void bind_submodule(py::module m) {
 			"edge_features",
 			&NodeBipartiteObs::edge_features,
 			"The constraint matrix of the optimization problem, with rows for contraints and "
-			"columns for variables.");
+			"columns for variables.")
+		.def_property_readonly(
+			"nbytes",
+			[](NodeBipartiteObs const& self) { return buffer_size(self); },
+			"Number of bytes held in the observation buffers.")
+		.def(py::pickle(
+			[](py::object const& self) {
+				return node_bipartite_obs_state(self, pickle_default_protocol);
+			},
+			&node_bipartite_obs_from_state))
+		.def(
+			"__reduce_ex__",
+			[](py::object const& self, int protocol) {
+				return reduce_with_state(self, node_bipartite_obs_state(self, protocol));
+			},
+			py::arg("protocol"),
+			"Pickle the observation, with out of band buffers from protocol 5.")
+		.def(
+			"to_dlpack",
+			[](py::object const& self) {
+				auto const& obs = self.cast<NodeBipartiteObs const&>();
+				auto tensors = py::dict{};
+				tensors["column_features"] = dlpack_view(obs.column_features, self);
+				tensors["row_features"] = dlpack_view(obs.row_features, self);
+				tensors["edge_values"] = dlpack_view(obs.edge_features.values, self);
+				tensors["edge_indices"] = dlpack_view(obs.edge_features.indices, self);
+				return tensors;
+			},
+			R"(
+				Share the observation buffers as a dictionary of DLPack tensors.
 
-	auto node_bipartite = py::class_<NodeBipartite>(m, "NodeBipartite", R"(
+				The tensors are adopted without copy by ``torch.from_dlpack`` and similar functions.
+				They keep the observation alive, and share its buffers with the NumPy arrays
+				obtained from it.
+				Assigning new edge features to the observation invalidates its edge tensors.
+			)");
+
+	auto node_bipartite = py::class_<NodeBipartite, std::shared_ptr<NodeBipartite>>(
+		m, "NodeBipartite", R"(
 		Bipartite graph observation function on branch-and bound node.
 
 		This observation function extract structured :py:class:`NodeBipartiteObs`.
@@ -120,7 +337,9 @@ void bind_submodule(py::module m) {
 	def_reset(node_bipartite, "Cache some feature not expected to change during an episode.");
 	def_obtain_observation(node_bipartite, "Extract a new :py:class:`NodeBipartiteObs`.");
 
-	auto strong_branching_scores = py::class_<StrongBranchingScores>(m, "StrongBranchingScores", R"(
+	using StrongBranchingScoresPtr = std::shared_ptr<StrongBranchingScores>;
+	auto strong_branching_scores = py::class_<StrongBranchingScores, StrongBranchingScoresPtr>(
+		m, "StrongBranchingScores", R"(
 		Strong branching score observation function on branch-and bound node.
 
 		This observation obtains scores for all LP or pseudo candidate variables at a
@@ -146,6 +365,32 @@ void bind_submodule(py::module m) {
 		strong_branching_scores, "Cache some feature not expected to change during an episode.");
 	def_obtain_observation(
 		strong_branching_scores, "Extract an array containing strong branching scores.");
+	strong_branching_scores.def(
+		"obtain_observation_dlpack",
+		[](StrongBranchingScores& self, scip::Model& model) -> nonstd::optional<dlpack::DLPackTensor> {
+			auto scores = [&] {
+				py::gil_scoped_release release{};
+				return self.obtain_observation(model);
+			}();
+			if (!scores.has_value()) return {};
+			return dlpack::DLPackTensor{std::move(scores.value())};
+		},
+		py::arg("model"),
+		"Extract strong branching scores in a DLPack tensor, or None if not available.");
+
+	auto native_dict_function = py::class_<NativeDictFunction>(m, "NativeDictFunction", R"(
+		Composition of native observation functions, returning observations as dicts.
+
+		All observations are extracted in C++ in a single call, without holding the GIL.
+		The composed functions are shared with Python.
+	)");
+	native_dict_function.def(
+		py::init(&make_native_dict_function),
+		py::arg("observation_functions"),
+		"Compose a dictionary of NodeBipartite, StrongBranchingScores, or Nothing functions.");
+	def_reset(native_dict_function, "Call reset on all observation functions, in order.");
+	def_obtain_observation(
+		native_dict_function, "Return observation from all functions as a dict.");
 }
 
 }  // namespace observation
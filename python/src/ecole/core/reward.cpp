@@ -1,35 +1,118 @@
+#include <cmath>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <pybind11/eval.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
+#include "ecole/reward/arithmetic.hpp"
 #include "ecole/reward/constant.hpp"
 #include "ecole/reward/isdone.hpp"
 #include "ecole/reward/lpiterations.hpp"
+#include "ecole/reward/nnodes.hpp"
+#include "ecole/reward/primaldualintegral.hpp"
+#include "ecole/reward/progress.hpp"
+#include "ecole/reward/solvingtime.hpp"
+#include "ecole/reward/treesize.hpp"
 #include "ecole/scip/model.hpp"
 
 #include "core.hpp"
+#include "reward.hpp"
 
 namespace py = pybind11;
 
 namespace ecole {
 namespace reward {
 
+/**
+ * Reward function defined in Python, called with the GIL held.
+ */
+class PyRewardFunction : public RewardFunction {
+public:
+	PyRewardFunction(py::object function);
+	~PyRewardFunction() override;
+
+	void before_reset(scip::Model& model) override;
+	void reset(scip::Model const& model) override;
+	Reward obtain_reward(scip::Model const& model, bool done) override;
+
+private:
+	py::object function;
+};
+
+/**
+ * Reward function applying a Python operation on the rewards of other reward functions.
+ *
+ * Used for the few operators without a native equivalent.
+ */
+class PyOperation : public RewardFunction {
+public:
+	PyOperation(py::object operation, std::vector<std::shared_ptr<RewardFunction>> functions);
+	~PyOperation() override;
+
+	void before_reset(scip::Model& model) override;
+	void reset(scip::Model const& model) override;
+	Reward obtain_reward(scip::Model const& model, bool done) override;
+
+private:
+	py::object operation;
+	std::vector<std::shared_ptr<RewardFunction>> functions;
+};
+
+/**
+ * Division by zero in a native arithmetic operation, raised as a ZeroDivisionError in Python.
+ */
+class ZeroDivision : public std::domain_error {
+public:
+	using std::domain_error::domain_error;
+};
+
+/**
+ * Arithmetic operations with Python semantic, including raising on division by zero.
+ */
+static Reward divide(Reward x, Reward y) {
+	if (y == 0.) throw ZeroDivision{"float division by zero"};
+	return x / y;
+}
+static Reward floor_divide(Reward x, Reward y) {
+	if (y == 0.) throw ZeroDivision{"float floor division by zero"};
+	return std::floor(x / y);
+}
+static Reward modulo(Reward x, Reward y) {
+	if (y == 0.) throw ZeroDivision{"float modulo"};
+	return x - y * std::floor(x / y);
+}
+static Reward power(Reward x, Reward y) {
+	if ((x == 0.) && (y < 0.)) throw ZeroDivision{"0.0 cannot be raised to a negative power"};
+	return std::pow(x, y);
+}
+
 /**
  * Proxy class for doing arithmetic on reward functions.
  *
- * This could be a pure Python class, but it needs to be defined in this module to
- * be accessible to reward functions operators.
+ * Wraps the expression tree of reward functions resulting from an operator, along with its
+ * representation.
+ * Only reward functions defined in Python, and a few Python operations, need the GIL.
  */
-class Arithmetic {
+class Arithmetic : public RewardFunction {
 public:
+	Arithmetic(std::shared_ptr<RewardFunction> expression, std::string repr);
 	Arithmetic(py::object operation, py::list functions, py::str repr);
-	void reset(py::object model);
-	Reward obtain_reward(py::object model, bool done);
-	py::str toString() const;
+
+	void before_reset(scip::Model& model) override;
+	void reset(scip::Model const& model) override;
+	Reward obtain_reward(scip::Model const& model, bool done) override;
+	std::string const& toString() const;
 
 private:
-	py::object operation;
-	py::list functions;
-	py::str repr;
+	std::shared_ptr<RewardFunction> expression;
+	std::string repr;
 };
 
 /**
@@ -45,7 +128,25 @@ template <typename PyClass> void def_operators(PyClass);
 void bind_submodule(py::module m) {
 	m.doc() = "Reward classes for Ecole.";
 
-	auto constant = py::class_<Constant>(m, "Constant", R"(
+	py::register_exception_translator([](std::exception_ptr ptr) {
+		try {
+			if (ptr) std::rethrow_exception(ptr);
+		} catch (ZeroDivision const& e) {
+			PyErr_SetString(PyExc_ZeroDivisionError, e.what());
+		}
+	});
+
+	py::class_<RewardFunction, std::shared_ptr<RewardFunction>>(
+		m, "RewardFunction", "Base class of reward functions implemented in C++.")
+		.def(
+			"before_reset",
+			&RewardFunction::before_reset,
+			py::arg("model"),
+			py::call_guard<py::gil_scoped_release>(),
+			"Prepare the model before the environment brings it to its initial state.");
+
+	auto constant =
+		py::class_<Constant, RewardFunction, std::shared_ptr<Constant>>(m, "Constant", R"(
 		Constant Reward.
 
 		Always return the value passed in constructor.
@@ -57,11 +158,14 @@ void bind_submodule(py::module m) {
 	def_reset(constant, "Do nothing.");
 	def_obtain_reward(constant, "Return the constant value.");
 
-	auto arithmetic = py::class_<Arithmetic>(m, "Arithmetic", R"(
+	auto arithmetic =
+		py::class_<Arithmetic, RewardFunction, std::shared_ptr<Arithmetic>>(m, "Arithmetic", R"(
 		Proxy class for doing arithmetic on reward functions.
 
 		An object of this class is returned by reward functions operators to forward calls
 		to the reward functions parameters of the operator.
+		The operations are evaluated in C++ without the GIL, unless some operands are reward
+		functions defined in Python.
 	)");
 	arithmetic  //
 		.def(py::init<py::object, py::list, py::str>())
@@ -80,19 +184,25 @@ void bind_submodule(py::module m) {
 		this object and compute the operation on the results.
 	)");
 
-	auto isdone = py::class_<IsDone>(m, "IsDone", "Single reward on terminal states.");
+	auto isdone = py::class_<IsDone, RewardFunction, std::shared_ptr<IsDone>>(
+		m, "IsDone", "Single reward on terminal states.");
 	isdone.def(py::init<>());
 	def_operators(isdone);
 	def_reset(isdone, "Do nothing.");
 	def_obtain_reward(isdone, "Return 1 if the episode is on a terminal state, 0 otherwise.");
 
-	auto lpiterations = py::class_<LpIterations>(m, "LpIterations", R"(
+	auto lpiterations = py::class_<LpIterations, RewardFunction, std::shared_ptr<LpIterations>>(
+		m, "LpIterations", R"(
 		LP Iteration difference.
 
 		The reward is defined as the number of iterations done solving the Linear Program
 		associated with the problem since the previous state.
 	)");
-	lpiterations.def(py::init<>());
+	lpiterations.def(py::init<>())
+		.def_property_readonly(
+			"lp_iterations_saved",
+			&LpIterations::lp_iterations_saved,
+			"Root LP iterations saved in the episode by warm starting from a root basis cache.");
 	def_operators(lpiterations);
 	def_reset(lpiterations, "Reset the internal LP iterations count.");
 	def_obtain_reward(lpiterations, R"(
@@ -100,48 +210,212 @@ void bind_submodule(py::module m) {
 
 		The difference in LP iteration is computed in between calls.
 		)");
+
+	auto solvingtime = py::class_<SolvingTime, RewardFunction, std::shared_ptr<SolvingTime>>(
+		m, "SolvingTime", R"(
+		Solving time difference.
+
+		The reward is defined as the negated number of seconds spent by the solver since the
+		previous state.
+		Time is only measured while the solver runs, with nanosecond resolution, excluding the
+		time spent in the environment.
+	)");
+	solvingtime  //
+		.def(py::init<bool>(), py::arg("wall") = false, R"(
+			Create a SolvingTime reward function.
+
+			Parameters
+			----------
+			wall:
+				If true, measure wall clock time, otherwise the CPU time of the solving thread.
+		)")
+		.def_readonly("wall", &SolvingTime::wall);
+	def_operators(solvingtime);
+	def_reset(solvingtime, "Reset the internal solving time.");
+	def_obtain_reward(solvingtime, "Update the internal solving time and return the difference.");
+
+	auto primaldualintegral =
+		py::class_<PrimalDualIntegral, RewardFunction, std::shared_ptr<PrimalDualIntegral>>(
+			m, "PrimalDualIntegral", R"(
+		Primal-dual integral difference.
+
+		The reward is defined as the negated primal-dual integral since the previous state,
+		where the primal-dual gap function is between 0 and 1.
+		The integral is updated by an event handler on the solver thread at every bound change.
+	)");
+	primaldualintegral.def(py::init<>());
+	def_operators(primaldualintegral);
+	def_reset(primaldualintegral, "Reset the internal integral.");
+	def_obtain_reward(primaldualintegral, "Return the integral since the previous call.");
+
+	auto nnodes = py::class_<NNodes, RewardFunction, std::shared_ptr<NNodes>>(m, "NNodes", R"(
+		Number of nodes difference.
+
+		The reward is defined as the negated number of nodes processed since the previous state.
+	)");
+	nnodes.def(py::init<>());
+	def_operators(nnodes);
+	def_reset(nnodes, "Reset the internal node count.");
+	def_obtain_reward(nnodes, "Update the internal node count and return the difference.");
+
+	auto treesize =
+		py::class_<TreeSize, RewardFunction, std::shared_ptr<TreeSize>>(m, "TreeSize", R"(
+		Estimated tree size difference.
+
+		The reward is defined as the negated change of the search tree size estimated by SCIP
+		since the previous state, or zero while no estimate is available.
+	)");
+	treesize.def(py::init<>());
+	def_operators(treesize);
+	def_reset(treesize, "Reset the internal tree size estimate.");
+	def_obtain_reward(treesize, "Update the internal tree size estimate and return the difference.");
+
+	PYBIND11_NUMPY_DTYPE(Progress::Rewards, lp_iterations, n_nodes, tree_size, solving_time);
+	py::class_<Progress>(m, "Progress", R"(
+		Several progress rewards computed together.
+
+		Components have the same values as :py:class:`LpIterations`, :py:class:`NNodes`,
+		:py:class:`TreeSize`, and :py:class:`SolvingTime`, but are computed from a single
+		statistics snapshot.
+	)")
+		.def(py::init<>())
+		.def("reset", &Progress::reset, py::arg("model"), py::call_guard<py::gil_scoped_release>())
+		.def(
+			"obtain_rewards",
+			[](Progress& progress, scip::Model const& model, bool done) {
+				auto rewards = py::array_t<Progress::Rewards>(1);
+				auto const values = [&] {
+					py::gil_scoped_release release;
+					return progress.obtain_rewards(model, done);
+				}();
+				*rewards.mutable_data() = values;
+				return rewards[py::int_(0)];
+			},
+			py::arg("model"),
+			py::arg("done") = false,
+			"Return the rewards as a NumPy structured record.");
+}
+
+/************************************
+ *  Definition of PyRewardFunction  *
+ ************************************/
+
+PyRewardFunction::PyRewardFunction(py::object function_) : function(std::move(function_)) {}
+
+PyRewardFunction::~PyRewardFunction() {
+	// The last reference may be dropped by a thread not holding the GIL
+	py::gil_scoped_acquire gil;
+	auto const to_delete = std::move(function);
+}
+
+void PyRewardFunction::before_reset(scip::Model& model) {
+	py::gil_scoped_acquire gil;
+	if (py::hasattr(function, "before_reset")) {
+		function.attr("before_reset")(py::cast(model, py::return_value_policy::reference));
+	}
+}
+
+void PyRewardFunction::reset(scip::Model const& model) {
+	py::gil_scoped_acquire gil;
+	function.attr("reset")(py::cast(model, py::return_value_policy::reference));
+}
+
+Reward PyRewardFunction::obtain_reward(scip::Model const& model, bool done) {
+	py::gil_scoped_acquire gil;
+	return function.attr("obtain_reward")(py::cast(model, py::return_value_policy::reference), done)
+		.cast<Reward>();
+}
+
+/*******************************
+ *  Definition of PyOperation  *
+ *******************************/
+
+PyOperation::PyOperation(
+	py::object operation_,
+	std::vector<std::shared_ptr<RewardFunction>> functions_) :
+	operation(std::move(operation_)), functions(std::move(functions_)) {}
+
+PyOperation::~PyOperation() {
+	py::gil_scoped_acquire gil;
+	auto const to_delete = std::move(operation);
+}
+
+void PyOperation::before_reset(scip::Model& model) {
+	for (auto& func : functions) {
+		func->before_reset(model);
+	}
+}
+
+void PyOperation::reset(scip::Model const& model) {
+	for (auto& func : functions) {
+		func->reset(model);
+	}
+}
+
+Reward PyOperation::obtain_reward(scip::Model const& model, bool done) {
+	auto rewards = std::vector<Reward>{};
+	rewards.reserve(functions.size());
+	for (auto& func : functions) {
+		rewards.push_back(func->obtain_reward(model, done));
+	}
+	py::gil_scoped_acquire gil;
+	return operation(*py::cast(rewards)).cast<Reward>();
 }
 
 /******************************
  *  Definition of Arithmetic  *
  ******************************/
 
-Arithmetic::Arithmetic(py::object operation_, py::list functions_, py::str repr_) :
-	operation(std::move(operation_)), repr(std::move(repr_)) {
-	auto const Numbers = py::module::import("numbers").attr("Number");
-	for (auto func : functions_) {
-		if (py::isinstance(func, Numbers)) {
-			functions.append(py::cast(Constant{func.cast<Reward>()}));
-		} else {
-			functions.append(func);
-		}
+Arithmetic::Arithmetic(std::shared_ptr<RewardFunction> expression_, std::string repr_) :
+	expression(std::move(expression_)), repr(std::move(repr_)) {}
+
+Arithmetic::Arithmetic(py::object operation, py::list functions, py::str repr_) {
+	auto native_functions = std::vector<std::shared_ptr<RewardFunction>>{};
+	for (auto func : functions) {
+		native_functions.push_back(as_reward_function(func));
 	}
+	expression = std::make_shared<PyOperation>(std::move(operation), std::move(native_functions));
+	repr = repr_.format(*functions).cast<std::string>();
 }
 
-void Arithmetic::reset(py::object model) {
-	for (auto obs_func : functions) {
-		obs_func.attr("reset")(model);
-	}
+void Arithmetic::before_reset(scip::Model& model) {
+	expression->before_reset(model);
 }
 
-Reward Arithmetic::obtain_reward(py::object model, bool done) {
-	py::list rewards{};
-	for (auto obs_func : functions) {
-		rewards.append(obs_func.attr("obtain_reward")(model, done));
-	}
-	return operation(*rewards).cast<Reward>();
+void Arithmetic::reset(scip::Model const& model) {
+	expression->reset(model);
+}
+
+Reward Arithmetic::obtain_reward(scip::Model const& model, bool done) {
+	return expression->obtain_reward(model, done);
 }
 
-py::str Arithmetic::toString() const {
-	return repr.format(*functions);
+std::string const& Arithmetic::toString() const {
+	return repr;
 }
 
 /************************************
  *  Definition of helper functions  *
  ************************************/
 
+std::shared_ptr<RewardFunction> as_reward_function(py::handle obj) {
+	if (py::isinstance<RewardFunction>(obj)) {
+		return obj.cast<std::shared_ptr<RewardFunction>>();
+	}
+	auto const Numbers = py::module::import("numbers").attr("Number");
+	if (py::isinstance(obj, Numbers)) {
+		return std::make_shared<Constant>(obj.cast<Reward>());
+	}
+	return std::make_shared<PyRewardFunction>(py::reinterpret_borrow<py::object>(obj));
+}
+
 template <typename PyClass, typename... Args> void def_reset(PyClass pyclass, Args&&... args) {
-	pyclass.def("reset", &PyClass::type::reset, py::arg("model"), std::forward<Args>(args)...);
+	pyclass.def(
+		"reset",
+		&PyClass::type::reset,
+		py::arg("model"),
+		py::call_guard<py::gil_scoped_release>(),
+		std::forward<Args>(args)...);
 }
 
 template <typename PyClass, typename... Args>
@@ -151,6 +425,7 @@ void def_obtain_reward(PyClass pyclass, Args&&... args) {
 		&PyClass::type::obtain_reward,
 		py::arg("model"),
 		py::arg("done") = false,
+		py::call_guard<py::gil_scoped_release>(),
 		std::forward<Args>(args)...);
 }
 
@@ -159,65 +434,98 @@ template <typename PyClass> void def_operators(PyClass pyclass) {
 	auto const builtins = py::module::import("builtins");
 	auto const math = py::module::import("math");
 
-	// Return a function that wraps rewards functions inside an ArithmeticReward.
-	// The Arithmetic reward function is a reward function class that will call the wrapped
-	// reward functions and merge there rewards with the relevant operation (sum, prod, ...)
-	auto const arith_meth = [](auto operation, auto repr) {
+	// Return functions that wrap rewards functions inside an Arithmetic reward function.
+	// The Arithmetic reward function is an expression tree that calls the wrapped reward
+	// functions and merges their rewards with the relevant operation (sum, prod, ...).
+	auto const unary_meth = [](UnaryArithmetic::Operation operation, char const* repr) {
+		return [operation, repr](py::object self) {
+			auto expression = std::make_shared<UnaryArithmetic>(operation, as_reward_function(self));
+			return Arithmetic{std::move(expression), py::str(repr).format(self).cast<std::string>()};
+		};
+	};
+	auto const binary_meth = [](BinaryArithmetic::Operation operation, char const* repr) {
+		return [operation, repr](py::object self, py::object other) {
+			auto expression = std::make_shared<BinaryArithmetic>(
+				operation, as_reward_function(self), as_reward_function(other));
+			auto const repr_str = py::str(repr).format(self, other).cast<std::string>();
+			return Arithmetic{std::move(expression), repr_str};
+		};
+	};
+	// Operators without native equivalent, mostly integer ones, are computed in Python
+	auto const py_meth = [](auto operation, auto repr) {
 		return [operation, repr](py::args args) { return Arithmetic{operation, args, repr}; };
 	};
 
 	pyclass
 		// Binary operators
-		.def("__add__", arith_meth(py::eval("lambda x, y: x + y"), "({} + {})"))
-		.def("__sub__", arith_meth(py::eval("lambda x, y: x - y"), "({} - {})"))
-		.def("__mul__", arith_meth(py::eval("lambda x, y: x * y"), "({} * {})"))
-		.def("__matmul__", arith_meth(py::eval("lambda x, y: x @ y"), "({} @ {})"))
-		.def("__truediv__", arith_meth(py::eval("lambda x, y: x / y"), "({} / {})"))
-		.def("__floordiv__", arith_meth(py::eval("lambda x, y: x // y"), "({} // {})"))
-		.def("__mod__", arith_meth(py::eval("lambda x, y: x % y"), "({} % {})"))
-		.def("__divmod__", arith_meth(builtins.attr("divmod"), "divmod({}, {})"))
-		.def("__pow__", arith_meth(builtins.attr("pow"), "({} ** {})"))
-		.def("__lshift__", arith_meth(py::eval("lambda x, y: x << y"), "({} << {})"))
-		.def("__rshift__", arith_meth(py::eval("lambda x, y: x >> y"), "({} >> {})"))
-		.def("__and__", arith_meth(py::eval("lambda x, y: x & y"), "({} & {})"))
-		.def("__xor__", arith_meth(py::eval("lambda x, y: x ^ y"), "({} ^ {})"))
-		.def("__or__", arith_meth(py::eval("lambda x, y: x | y"), "({} | {})"))
+		.def("__add__", binary_meth([](Reward x, Reward y) { return x + y; }, "({} + {})"))
+		.def("__sub__", binary_meth([](Reward x, Reward y) { return x - y; }, "({} - {})"))
+		.def("__mul__", binary_meth([](Reward x, Reward y) { return x * y; }, "({} * {})"))
+		.def("__matmul__", py_meth(py::eval("lambda x, y: x @ y"), "({} @ {})"))
+		.def("__truediv__", binary_meth(divide, "({} / {})"))
+		.def("__floordiv__", binary_meth(floor_divide, "({} // {})"))
+		.def("__mod__", binary_meth(modulo, "({} % {})"))
+		.def("__divmod__", py_meth(builtins.attr("divmod"), "divmod({}, {})"))
+		.def("__pow__", binary_meth(power, "({} ** {})"))
+		.def("__lshift__", py_meth(py::eval("lambda x, y: x << y"), "({} << {})"))
+		.def("__rshift__", py_meth(py::eval("lambda x, y: x >> y"), "({} >> {})"))
+		.def("__and__", py_meth(py::eval("lambda x, y: x & y"), "({} & {})"))
+		.def("__xor__", py_meth(py::eval("lambda x, y: x ^ y"), "({} ^ {})"))
+		.def("__or__", py_meth(py::eval("lambda x, y: x | y"), "({} | {})"))
 		// Reversed binary operators
-		.def("__radd__", arith_meth(py::eval("lambda x, y: y + x"), "({1} + {0})"))
-		.def("__rsub__", arith_meth(py::eval("lambda x, y: y - x"), "({1} - {0})"))
-		.def("__rmul__", arith_meth(py::eval("lambda x, y: y * x"), "({1} * {0})"))
-		.def("__rmatmul__", arith_meth(py::eval("lambda x, y: y @ x"), "({1} @ {0})"))
-		.def("__rtruediv__", arith_meth(py::eval("lambda x, y: y / x"), "({1} / {0})"))
-		.def("__rfloordiv__", arith_meth(py::eval("lambda x, y: y // x"), "({1} // {0})"))
-		.def("__rmod__", arith_meth(py::eval("lambda x, y: y % x"), "({1} % {0})"))
-		.def("__rdivmod__", arith_meth(py::eval("lambda x, y: divmod(y, x)"), "divmod({1}, {0})"))
-		.def("__rpow__", arith_meth(py::eval("lambda x, y: y ** x"), "({1} ** {0})"))
-		.def("__rlshift__", arith_meth(py::eval("lambda x, y: y << x"), "({1} << {0})"))
-		.def("__rrshift__", arith_meth(py::eval("lambda x, y: y >> x"), "({1} >> {0})"))
-		.def("__rand__", arith_meth(py::eval("lambda x, y: y & x"), "({1} & {0})"))
-		.def("__rxor__", arith_meth(py::eval("lambda x, y: y ^ x"), "({1} ^ {0})"))
-		.def("__ror__", arith_meth(py::eval("lambda x, y: y | x"), "({1} | {0})"))
+		.def("__radd__", binary_meth([](Reward x, Reward y) { return y + x; }, "({1} + {0})"))
+		.def("__rsub__", binary_meth([](Reward x, Reward y) { return y - x; }, "({1} - {0})"))
+		.def("__rmul__", binary_meth([](Reward x, Reward y) { return y * x; }, "({1} * {0})"))
+		.def("__rmatmul__", py_meth(py::eval("lambda x, y: y @ x"), "({1} @ {0})"))
+		.def(
+			"__rtruediv__",
+			binary_meth([](Reward x, Reward y) { return divide(y, x); }, "({1} / {0})"))
+		.def(
+			"__rfloordiv__",
+			binary_meth([](Reward x, Reward y) { return floor_divide(y, x); }, "({1} // {0})"))
+		.def("__rmod__", binary_meth([](Reward x, Reward y) { return modulo(y, x); }, "({1} % {0})"))
+		.def("__rdivmod__", py_meth(py::eval("lambda x, y: divmod(y, x)"), "divmod({1}, {0})"))
+		.def("__rpow__", binary_meth([](Reward x, Reward y) { return power(y, x); }, "({1} ** {0})"))
+		.def("__rlshift__", py_meth(py::eval("lambda x, y: y << x"), "({1} << {0})"))
+		.def("__rrshift__", py_meth(py::eval("lambda x, y: y >> x"), "({1} >> {0})"))
+		.def("__rand__", py_meth(py::eval("lambda x, y: y & x"), "({1} & {0})"))
+		.def("__rxor__", py_meth(py::eval("lambda x, y: y ^ x"), "({1} ^ {0})"))
+		.def("__ror__", py_meth(py::eval("lambda x, y: y | x"), "({1} | {0})"))
 		// Unary operator
-		.def("__neg__", arith_meth(py::eval("lambda x: -x"), "(-{})"))
-		.def("__pos__", arith_meth(py::eval("lambda x: +x"), "(+{})"))
-		.def("__abs__", arith_meth(builtins.attr("abs"), "(abs({}))"))
-		.def("__invert__", arith_meth(py::eval("lambda x: ~x"), "(~{})"))
-		.def("__int__", arith_meth(builtins.attr("int"), "int({})"))
-		.def("__float__", arith_meth(builtins.attr("float"), "float({})"))
-		.def("__complex__", arith_meth(builtins.attr("complex"), "complex({})"))
-		.def("__round__", arith_meth(builtins.attr("round"), "round({})"))
-		.def("__trunc__", arith_meth(math.attr("trunc"), "math.trunc({})"))
-		.def("__floor__", arith_meth(math.attr("floor"), "math.floor({})"))
-		.def("__ceil__", arith_meth(math.attr("ceil"), "math.ceil({})"));
-	// Custom Math methods
-	// clang-format off
-	for (auto const name : {
-		"exp", "log", "log2", "log10", "sqrt", "sin", "cos", "tan", "asin", "acos", "atan",
-		"sinh", "cosh", "tanh", "asinh", "acosh", "atanh", "isfinite", "isinf", "isnan"
-	}) {
-		pyclass.def(name, arith_meth(math.attr(name), std::string{"{}."} + name + "()"));
-	}
-	// clang-format on
+		.def("__neg__", unary_meth([](Reward x) { return -x; }, "(-{})"))
+		.def("__pos__", unary_meth([](Reward x) { return +x; }, "(+{})"))
+		.def("__abs__", unary_meth([](Reward x) { return std::abs(x); }, "(abs({}))"))
+		.def("__invert__", py_meth(py::eval("lambda x: ~x"), "(~{})"))
+		.def("__int__", unary_meth([](Reward x) { return std::trunc(x); }, "int({})"))
+		.def("__float__", unary_meth([](Reward x) { return x; }, "float({})"))
+		.def("__complex__", py_meth(builtins.attr("complex"), "complex({})"))
+		// Round half to even, as Python does
+		.def("__round__", unary_meth([](Reward x) { return std::nearbyint(x); }, "round({})"))
+		.def("__trunc__", unary_meth([](Reward x) { return std::trunc(x); }, "math.trunc({})"))
+		.def("__floor__", unary_meth([](Reward x) { return std::floor(x); }, "math.floor({})"))
+		.def("__ceil__", unary_meth([](Reward x) { return std::ceil(x); }, "math.ceil({})"))
+		// Custom Math methods
+		.def("exp", unary_meth([](Reward x) { return std::exp(x); }, "{}.exp()"))
+		.def("log", unary_meth([](Reward x) { return std::log(x); }, "{}.log()"))
+		.def("log2", unary_meth([](Reward x) { return std::log2(x); }, "{}.log2()"))
+		.def("log10", unary_meth([](Reward x) { return std::log10(x); }, "{}.log10()"))
+		.def("sqrt", unary_meth([](Reward x) { return std::sqrt(x); }, "{}.sqrt()"))
+		.def("sin", unary_meth([](Reward x) { return std::sin(x); }, "{}.sin()"))
+		.def("cos", unary_meth([](Reward x) { return std::cos(x); }, "{}.cos()"))
+		.def("tan", unary_meth([](Reward x) { return std::tan(x); }, "{}.tan()"))
+		.def("asin", unary_meth([](Reward x) { return std::asin(x); }, "{}.asin()"))
+		.def("acos", unary_meth([](Reward x) { return std::acos(x); }, "{}.acos()"))
+		.def("atan", unary_meth([](Reward x) { return std::atan(x); }, "{}.atan()"))
+		.def("sinh", unary_meth([](Reward x) { return std::sinh(x); }, "{}.sinh()"))
+		.def("cosh", unary_meth([](Reward x) { return std::cosh(x); }, "{}.cosh()"))
+		.def("tanh", unary_meth([](Reward x) { return std::tanh(x); }, "{}.tanh()"))
+		.def("asinh", unary_meth([](Reward x) { return std::asinh(x); }, "{}.asinh()"))
+		.def("acosh", unary_meth([](Reward x) { return std::acosh(x); }, "{}.acosh()"))
+		.def("atanh", unary_meth([](Reward x) { return std::atanh(x); }, "{}.atanh()"))
+		.def(
+			"isfinite", unary_meth([](Reward x) { return std::isfinite(x) ? 1. : 0.; }, "{}.isfinite()"))
+		.def("isinf", unary_meth([](Reward x) { return std::isinf(x) ? 1. : 0.; }, "{}.isinf()"))
+		.def("isnan", unary_meth([](Reward x) { return std::isnan(x) ? 1. : 0.; }, "{}.isnan()"));
 	pyclass.def("apply", [](py::object self, py::object func) {
 		return Arithmetic{func, py::make_tuple(self), "lambda({})"};
 	});
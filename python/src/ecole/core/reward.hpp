@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+
+#include "ecole/reward/abstract.hpp"
+
+namespace ecole {
+namespace reward {
+
+/**
+ * Convert numbers, native, and Python reward functions to a native reward function.
+ *
+ * Reward functions defined in Python are wrapped to be called with the GIL held.
+ */
+std::shared_ptr<RewardFunction> as_reward_function(pybind11::handle obj);
+
+/**
+ * Reward function value forwarding to a shared reward function.
+ *
+ * Used as the (single) reward function type of environments bound to Python.
+ */
+class SharedRewardFunction : public RewardFunction {
+public:
+	SharedRewardFunction(std::shared_ptr<RewardFunction> function_) noexcept :
+		function(std::move(function_)) {}
+
+	void before_reset(scip::Model& model) override { function->before_reset(model); }
+	void reset(scip::Model const& model) override { function->reset(model); }
+	Reward obtain_reward(scip::Model const& model, bool done = false) override {
+		return function->obtain_reward(model, done);
+	}
+
+private:
+	std::shared_ptr<RewardFunction> function;
+};
+
+}  // namespace reward
+}  // namespace ecole
@@ -1,10 +1,24 @@
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <map>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
+#include <nonstd/span.hpp>
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 
+#include "ecole/scip/basis-cache.hpp"
 #include "ecole/scip/model.hpp"
+#include "ecole/scip/pool.hpp"
+#include "ecole/scip/presolve-cache.hpp"
 #include "ecole/scip/scimpl.hpp"
 
 #include "core.hpp"
@@ -14,13 +28,140 @@ namespace scip {
 
 namespace py = pybind11;
 
+/**
+ * Wrap solver statistics in a NumPy structured scalar.
+ */
+static py::object as_record(SolverStats const& stats) {
+	auto array = py::array_t<SolverStats>(1);
+	*array.mutable_data() = stats;
+	return array[py::int_(0)];
+}
+
+/**
+ * Get a view on the memory of a contiguous Python buffer (bytes, memoryview...).
+ */
+static nonstd::span<char const> as_span(py::buffer_info const& info) {
+	if ((info.ndim > 1) || ((info.ndim == 1) && (info.strides[0] != info.itemsize)))
+		throw std::invalid_argument("Buffer must be contiguous");
+	auto const size = static_cast<std::size_t>(info.size * info.itemsize);
+	return {static_cast<char const*>(info.ptr), size};
+}
+
+/**
+ * Encode the original problem, as a snapshot when possible, otherwise in CIP format.
+ */
+static std::pair<std::string, std::vector<char>> encode_problem(Model const& model) {
+	if (model.get_stage() == SCIP_STAGE_INIT) return {"", {}};
+	try {
+		return {"snapshot", model.write_snapshot()};
+	} catch (scip::Exception const&) {
+		return {"cip", model.write_orig_prob_buffer("cip")};
+	}
+}
+
+static Model
+decode_problem(std::string const& format, nonstd::span<char const> data, PluginProfile profile) {
+	if (format.empty()) return Model{profile};
+	if (format == "snapshot") return Model::from_snapshot(data, profile);
+	return Model::from_buffer(data, format, profile);
+}
+
+/**
+ * Pickle state of a Model: its original problem, non default parameters, and plugin profile.
+ *
+ * The solving state is not saved.
+ */
+static py::tuple get_model_state(Model const& model) {
+	auto encoded = decltype(encode_problem(model)){};
+	auto params = std::map<std::string, Param>{};
+	{
+		py::gil_scoped_release release{};
+		encoded = encode_problem(model);
+		params = model.get_non_default_params();
+	}
+	return py::make_tuple(
+		encoded.first,
+		py::bytes(encoded.second.data(), encoded.second.size()),
+		std::move(params),
+		to_string(model.plugin_profile()));
+}
+
+static Model set_model_state(py::tuple const& state) {
+	if (state.size() != 4) throw std::runtime_error("Invalid Model state");
+	auto const format = state[0].cast<std::string>();
+	auto params = state[2].cast<std::map<std::string, Param>>();
+	auto const profile = plugin_profile_from_string(state[3].cast<std::string>());
+	auto const info = state[1].cast<py::buffer>().request();
+	py::gil_scoped_release release{};
+	auto model = decode_problem(format, as_span(info), profile);
+	model.set_params(std::move(params));
+	return model;
+}
+
 void bind_submodule(py::module m) {
 	m.doc() = "Scip wrappers for ecole.";
 
 	py::register_exception<scip::Exception>(m, "Exception");
 
+	PYBIND11_NUMPY_DTYPE(MemoryStats, used, total, peak, external);
+	PYBIND11_NUMPY_DTYPE(
+		SolverStats,
+		n_nodes,
+		n_lp_iterations,
+		primal_bound,
+		dual_bound,
+		gap,
+		solving_time,
+		depth,
+		tree_size_estimate,
+		memory);
+
 	py::class_<Model, std::shared_ptr<Model>>(m, "Model")  //
-		.def_static("from_file", &Model::from_file)
+		.def(
+			py::init([](std::string const& profile) {
+				auto const plugin_profile = plugin_profile_from_string(profile);
+				py::gil_scoped_release release{};
+				return Model{plugin_profile};
+			}),
+			py::arg("profile") = "full",
+			"Create an empty model with the plugins of a profile (\"full\", \"minimal-branching\").")
+		.def_static(
+			"from_file",
+			[](std::string const& filepath, std::string const& profile) {
+				auto const plugin_profile = plugin_profile_from_string(profile);
+				py::gil_scoped_release release{};
+				return Model::from_file(filepath, plugin_profile);
+			},
+			py::arg("filepath"),
+			py::arg("profile") = "full",
+			"Read a problem file in a model with the plugins of a profile.")
+		.def_static(
+			"from_buffer",
+			[](py::buffer const& buffer, std::string const& format) {
+				auto const info = buffer.request();
+				auto const data = as_span(info);
+				py::gil_scoped_release release{};
+				return Model::from_buffer(data, format);
+			},
+			py::arg("buffer"),
+			py::arg("format"),
+			"Parse a problem held in memory (bytes, memoryview...) in the given format (mps, lp...).")
+		.def_static(
+			"from_snapshot",
+			[](py::buffer const& buffer) {
+				auto const info = buffer.request();
+				auto const data = as_span(info);
+				py::gil_scoped_release release{};
+				return Model::from_snapshot(data);
+			},
+			py::arg("buffer"),
+			"Load a problem from an Ecole binary snapshot held in memory.")
+		.def_static(
+			"from_snapshot_file",
+			&Model::from_snapshot_file,
+			py::arg("filepath"),
+			py::call_guard<py::gil_scoped_release>(),
+			"Load a problem from an Ecole binary snapshot file (memory mapped).")
 		.def_static(
 			"from_pyscipopt",
 			[](py::object pyscipopt_model) {
@@ -28,6 +169,7 @@ void bind_submodule(py::module m) {
 					auto pyptr = pyscipopt_model.attr("to_ptr")(py::arg("give_ownership") = true);
 					std::unique_ptr<SCIP, ScipDeleter> uptr = nullptr;
 					uptr.reset(reinterpret_cast<SCIP*>(pyptr.cast<std::uintptr_t>()));
+					py::gil_scoped_release release{};
 					return Model(std::make_unique<Scimpl>(std::move(uptr)));
 				} else {
 					throw scip::Exception(
@@ -41,6 +183,11 @@ void bind_submodule(py::module m) {
 
 		.def(py::self == py::self)
 		.def(py::self != py::self)
+		.def(py::pickle(&get_model_state, &set_model_state))
+		.def_property_readonly(
+			"profile",
+			[](Model const& model) { return to_string(model.plugin_profile()); },
+			"Name of the plugin profile the model was created with.")
 
 		.def("copy_orig", &Model::copy_orig, py::call_guard<py::gil_scoped_release>())
 		.def(
@@ -55,14 +202,243 @@ void bind_submodule(py::module m) {
 			// is alive, as PyScipOpt is a view on the ecole Model.
 			py::keep_alive<0, 1>())
 
-		.def("get_param", &Model::get_param<Param>, py::arg("name"))
-		.def("set_param", &Model::set_param<Param>, py::arg("name"), py::arg("value"))
-		.def("get_params", &Model::get_params)
-		.def("set_params", &Model::set_params, py::arg("name_values"))
-		.def("disable_cuts", &Model::disable_cuts)
-		.def("disable_presolve", &Model::disable_presolve)
+		.def(
+			"write_orig_prob_buffer",
+			[](Model const& model, std::string const& format, bool generic_names) {
+				auto const buffer = [&] {
+					py::gil_scoped_release release{};
+					return model.write_orig_prob_buffer(format, generic_names);
+				}();
+				return py::bytes(buffer.data(), buffer.size());
+			},
+			py::arg("format"),
+			py::arg("generic_names") = false,
+			"Write the original problem in the given format (mps, lp...) into bytes.")
+		.def(
+			"write_snapshot",
+			[](Model const& model) {
+				auto const buffer = [&] {
+					py::gil_scoped_release release{};
+					return model.write_snapshot();
+				}();
+				return py::bytes(buffer.data(), buffer.size());
+			},
+			"Write the original problem as an Ecole binary snapshot into bytes.")
+		.def(
+			"write_snapshot_file",
+			&Model::write_snapshot_file,
+			py::arg("filepath"),
+			py::call_guard<py::gil_scoped_release>(),
+			"Write the original problem as an Ecole binary snapshot file.")
 
-		.def("solve", &Model::solve, py::call_guard<py::gil_scoped_release>());
+		.def(
+			"get_param",
+			&Model::get_param<Param>,
+			py::arg("name"),
+			py::call_guard<py::gil_scoped_release>())
+		.def(
+			"set_param",
+			&Model::set_param<Param>,
+			py::arg("name"),
+			py::arg("value"),
+			py::call_guard<py::gil_scoped_release>())
+		.def("get_params", &Model::get_params, py::call_guard<py::gil_scoped_release>())
+		.def(
+			"get_non_default_params",
+			&Model::get_non_default_params,
+			py::call_guard<py::gil_scoped_release>(),
+			"Get the parameters whose value differ from SCIP default.")
+		.def(
+			"reset_params",
+			&Model::reset_params,
+			py::call_guard<py::gil_scoped_release>(),
+			"Set all parameters back to their default value.")
+		.def(
+			"set_params",
+			&Model::set_params,
+			py::arg("name_values"),
+			py::call_guard<py::gil_scoped_release>())
+		.def("disable_cuts", &Model::disable_cuts, py::call_guard<py::gil_scoped_release>())
+		.def("disable_presolve", &Model::disable_presolve, py::call_guard<py::gil_scoped_release>())
+
+		.def("solve", &Model::solve, py::call_guard<py::gil_scoped_release>())
+		.def(
+			"solve_iter_stop",
+			&Model::solve_iter_stop,
+			py::call_guard<py::gil_scoped_release>(),
+			"Interrupt an iterative solving started by an environment.")
+		.def(
+			"free_transform",
+			&Model::free_transform,
+			py::call_guard<py::gil_scoped_release>(),
+			"Go back to the original problem, keeping the SCIP object to solve it again.")
+		.def(
+			"memory_stats",
+			&Model::memory_stats,
+			py::call_guard<py::gil_scoped_release>(),
+			"Memory used by the underlying SCIP solver.")
+		.def(
+			"stats",
+			[](Model const& model) {
+				auto const stats = [&model] {
+					py::gil_scoped_release release{};
+					return model.stats();
+				}();
+				return as_record(stats);
+			},
+			"Snapshot of the solver progress as a NumPy structured record.")
+		.def(
+			"solver_time",
+			[](Model const& model, bool wall) {
+				auto const time = model.solver_time();
+				return std::chrono::duration<double>{wall ? time.wall : time.cpu}.count();
+			},
+			py::arg("wall") = false,
+			"Seconds the solver ran, excluding the time waiting for the environment.\n\n"
+			"CPU time of the solving thread by default, as SolvingTime, or wall clock time.")
+		.def(
+			"enable_log_capture",
+			&Model::enable_log_capture,
+			py::arg("capacity") = Model::default_log_capacity,
+			py::call_guard<py::gil_scoped_release>(),
+			"Capture the solver output in a bounded in-memory ring buffer of the given bytes capacity.")
+		.def(
+			"disable_log_capture",
+			&Model::disable_log_capture,
+			py::call_guard<py::gil_scoped_release>(),
+			"Go back to a quiet solver.")
+		.def(
+			"log_tail",
+			&Model::log_tail,
+			py::arg("max_size") = std::numeric_limits<std::size_t>::max(),
+			py::call_guard<py::gil_scoped_release>(),
+			"The last characters of the captured log.")
+		.def(
+			"fingerprint",
+			&Model::fingerprint,
+			py::call_guard<py::gil_scoped_release>(),
+			"Hash of the original problem, identifying the instance.")
+		.def(
+			"enable_root_warm_start",
+			&Model::enable_root_warm_start,
+			py::arg("cache"),
+			py::call_guard<py::gil_scoped_release>(),
+			"Warm start the root LP of the next solves from the basis cached for this instance.")
+		.def(
+			"root_lp_iterations_saved",
+			&Model::root_lp_iterations_saved,
+			"Root LP iterations saved by the warm start in the current solve.");
+
+	py::class_<RootBasisCache, std::shared_ptr<RootBasisCache>>(
+		m, "RootBasisCache", "Optimal root LP bases of problem instances, keyed by fingerprint.")
+		.def(py::init<>())
+		.def_property_readonly("size", &RootBasisCache::size)
+		.def("clear", &RootBasisCache::clear, py::call_guard<py::gil_scoped_release>())
+		.def_property_readonly(
+			"n_warm_starts",
+			&RootBasisCache::n_warm_starts,
+			"Number of root LP solved from a warm start.")
+		.def_property_readonly(
+			"lp_iterations_saved",
+			&RootBasisCache::lp_iterations_saved,
+			"Root LP iterations saved compared to the cold solves of the same instances.");
+
+	py::class_<AffineVar>(
+		m, "AffineVar", "An original variable, as an affine function of presolved variables.")
+		.def_readonly("name", &AffineVar::name)
+		.def_readonly("constant", &AffineVar::constant)
+		.def_readonly(
+			"terms", &AffineVar::terms, "Index of presolved variables, and their coefficient.");
+
+	py::class_<PresolvedProblem, std::shared_ptr<PresolvedProblem>>(
+		m, "PresolvedProblem", "The problem of a model after presolving.")
+		.def(
+			py::init([](Model const& model) {
+				return std::make_shared<PresolvedProblem>(PresolvedProblem::presolve(model));
+			}),
+			py::arg("model"),
+			py::call_guard<py::gil_scoped_release>(),
+			"Presolve a copy of the original problem of the model, with its parameters.")
+		.def(
+			"copy_model",
+			[](PresolvedProblem const& problem) { return problem.model().copy_orig(); },
+			py::call_guard<py::gil_scoped_release>(),
+			"A new model whose original problem is the presolved problem.")
+		.def_property_readonly("original_variables", &PresolvedProblem::original_variables)
+		.def_property_readonly(
+			"presolve_time",
+			[](PresolvedProblem const& problem) {
+				return std::chrono::duration<double>{problem.presolve_time()}.count();
+			})
+		.def(
+			"to_original",
+			[](PresolvedProblem const& problem,
+				 py::array_t<SCIP_Real, py::array::c_style | py::array::forcecast> const& values) {
+				auto const n_values = static_cast<std::size_t>(values.size());
+				auto const original = problem.to_original({values.data(), n_values});
+				return py::array_t<SCIP_Real>(original.size(), original.data());
+			},
+			py::arg("values"),
+			"Values of the original variables, from the values of the presolved variables.");
+
+	py::class_<PresolveCache, std::shared_ptr<PresolveCache>>(
+		m, "PresolveCache", "Presolved problems, keyed by fingerprint and parameters except seeds.")
+		.def(py::init<>())
+		.def_static(
+			"key", &PresolveCache::key, py::arg("model"), py::call_guard<py::gil_scoped_release>())
+		.def(
+			"get_or_presolve",
+			[](PresolveCache& cache, Model const& model) {
+				return std::const_pointer_cast<PresolvedProblem>(cache.get_or_presolve(model));
+			},
+			py::arg("model"),
+			py::call_guard<py::gil_scoped_release>(),
+			"The presolved problem of the model, presolving it if not cached.\n\n"
+			"None if presolving ends the solve, in which case the original problem must be solved.")
+		.def_property_readonly("size", &PresolveCache::size)
+		.def("clear", &PresolveCache::clear, py::call_guard<py::gil_scoped_release>())
+		.def_property_readonly(
+			"n_hits", &PresolveCache::n_hits, "Number of presolved problems found in the cache.")
+		.def_property_readonly(
+			"n_misses", &PresolveCache::n_misses, "Number of problems presolved on a cache miss.")
+		.def_property_readonly(
+			"time_saved",
+			[](PresolveCache const& cache) {
+				return std::chrono::duration<double>{cache.time_saved()}.count();
+			},
+			"Seconds of presolving of the problems found in the cache.");
+
+	py::class_<MemoryStats>(m, "MemoryStats", "Memory used by a SCIP solver, in bytes.")
+		.def_readonly("used", &MemoryStats::used, "Block and buffer memory currently in use.")
+		.def_readonly("total", &MemoryStats::total, "Block and buffer memory currently allocated.")
+		.def_readonly("peak", &MemoryStats::peak, "Largest total memory seen.")
+		.def_readonly("external", &MemoryStats::external, "Estimated memory allocated externally.")
+		.def(py::pickle(
+			[](MemoryStats const& stats) {
+				return py::make_tuple(stats.used, stats.total, stats.peak, stats.external);
+			},
+			[](py::tuple const& state) {
+				if (state.size() != 4) throw std::runtime_error("Invalid MemoryStats state");
+				return MemoryStats{
+					state[0].cast<std::size_t>(),
+					state[1].cast<std::size_t>(),
+					state[2].cast<std::size_t>(),
+					state[3].cast<std::size_t>()};
+			}));
+
+	py::class_<ModelPool>(m, "ModelPool", "Pool of SCIP objects recycled when models are destroyed.")
+		.def_static(
+			"global_pool",
+			&ModelPool::global,
+			py::return_value_policy::reference,
+			"The pool used by all models.")
+		.def_property(
+			"capacity",
+			&ModelPool::capacity,
+			// Shrinking the pool frees SCIP objects
+			py::cpp_function(&ModelPool::set_capacity, py::call_guard<py::gil_scoped_release>()))
+		.def_property_readonly("size", &ModelPool::size)
+		.def("clear", &ModelPool::clear, py::call_guard<py::gil_scoped_release>());
 }
 
 }  // namespace scip
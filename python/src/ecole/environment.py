@@ -1,6 +1,7 @@
 """Ecole collection of environments."""
 
 import random
+import time
 
 import ecole.core as core
 import ecole.observation
@@ -8,29 +9,77 @@ import ecole.reward
 from ecole.core.environment import *
 
 
+def _observation_memory(observation):
+    """Number of bytes held in the (possibly nested) buffers of an observation."""
+    if isinstance(observation, (tuple, list)):
+        return sum(_observation_memory(obs) for obs in observation)
+    if isinstance(observation, dict):
+        return sum(_observation_memory(obs) for obs in observation.values())
+    return getattr(observation, "nbytes", 0)
+
+
 class EnvironmentComposer:
 
     __Dynamics__ = None
     __DefaultObservationFunction__ = ecole.observation.Nothing
     __DefaultRewardFunction__ = ecole.reward.IsDone
+    # C++ environments by observation function type, used when the observation function is native
+    __NativeEnvironments__ = {}
 
     def __init__(
         self,
         observation_function="default",
         reward_function="default",
         scip_params=None,
+        memory_budget=None,
+        root_basis_cache=None,
+        reuse_model=False,
+        presolve_cache=None,
         **dynamics_kwargs
     ) -> None:
         self.observation_function = self.__parse_observation_function(observation_function)
         self.reward_function = self.__parse_reward_function(reward_function)
         self.scip_params = scip_params if scip_params is not None else {}
+        self.memory_budget = memory_budget
+        self.root_basis_cache = root_basis_cache
+        self.reuse_model = reuse_model
+        self.presolve_cache = presolve_cache
+        self.presolved_problem = None
         self.model = None
         self.dynamics = self.__Dynamics__(**dynamics_kwargs)
         self.can_transition = False
-        self.random_engine = RandomEngine(
-            random.randint(RandomEngine.min_seed, RandomEngine.max_seed)
+        self.memory_exceeded = False
+        seed = random.randint(RandomEngine.min_seed, RandomEngine.max_seed)
+        self.random_engine = RandomEngine(seed)
+        self.native = self.__create_native()
+        if self.native is not None:
+            self.native.seed(seed)
+            self.episode = None
+        else:
+            # Episodes of Python dynamics or observation functions start as the native ones
+            self.episode = core.environment.EpisodeModel()
+
+    def __create_native(self):
+        """Create the C++ environment doing full transitions in a single call, if available."""
+        native_class = self.__NativeEnvironments__.get(type(self.observation_function))
+        if native_class is None:
+            return None
+        return native_class(
+            self.observation_function, self.reward_function, self.scip_params, self.dynamics
         )
 
+    def __sync_native(self):
+        """Forward the attributes that can be changed between transitions."""
+        self.native.memory_budget = 0 if self.memory_budget is None else self.memory_budget
+
+    def __sync_options(self, target):
+        """Forward the options used to start episodes to the native environment or episode."""
+        target.scip_params = self.scip_params
+        target.memory_budget = 0 if self.memory_budget is None else self.memory_budget
+        target.root_basis_cache = self.root_basis_cache
+        target.reuse_model = self.reuse_model
+        target.presolve_cache = self.presolve_cache
+
     @classmethod
     def __parse_reward_function(cls, reward_function):
         if reward_function == "default":
@@ -71,7 +120,8 @@ class EnvironmentComposer:
         ----------
         instance:
             The combinatorial optimization problem to tackle during the newly started
-            episode.
+            episode: a file path, a :py:class:`ecole.scip.Model` (of which a copy is solved), or
+            an :py:class:`ecole.instance.InstancePrefetcher` whose next instance is used.
 
         Returns
         -------
@@ -92,22 +142,43 @@ class EnvironmentComposer:
             If this is true, the episode is finished, and :meth:`step` cannot be called.
 
         """
-        self.can_transition = True
+        # Both paths solve a copy of the instance given as a Model
+        if not isinstance(instance, (core.scip.Model, core.instance.InstancePrefetcher)):
+            instance = str(instance)
+        self.can_transition = False
+
+        if self.native is not None:
+            self.__sync_options(self.native)
+            try:
+                observation, action_set, reward_offset, done = self.native.reset(instance)
+            finally:
+                self.model = self.native.model
+                self.presolved_problem = self.native.presolved_problem
+            self.can_transition = not done
+            return observation, action_set, reward_offset, done
+
+        self.__sync_options(self.episode)
         try:
-            if isinstance(instance, core.scip.Model):
-                self.model = instance
-            else:
-                self.model = core.scip.Model.from_file(instance)
-            self.model.set_params(self.scip_params)
+            self.episode.reset(instance)
+        finally:
+            self.model = self.episode.model
+            self.presolved_problem = self.episode.presolved_problem
 
+        self.can_transition = True
+        self.memory_exceeded = False
+        try:
             self.dynamics.set_dynamics_random_state(self.model, self.random_engine)
+            if hasattr(self.reward_function, "before_reset"):
+                self.reward_function.before_reset(self.model)
 
             done, action_set = self.dynamics.reset_dynamics(self.model)
+            done, action_set = self.__enforce_memory_budget(done, action_set)
             self.observation_function.reset(self.model)
             self.reward_function.reset(self.model)
 
             reward_offset = self.reward_function.obtain_reward(self.model)
             observation = self.observation_function.obtain_observation(self.model)
+            self.last_stats = self.model.stats()
             return observation, action_set, reward_offset, done
         except Exception as e:
             self.can_transition = False
@@ -146,20 +217,66 @@ class EnvironmentComposer:
             A collection of environment specific information about the transition.
             This is not necessary for the control problem, but is useful to gain
             insights about the environment.
+            It contains the ``"done_reason"`` (a :py:class:`DoneReason`), the solver
+            ``"memory"`` (a :py:class:`ecole.scip.MemoryStats`), and the
+            ``"observation_memory"`` in bytes.
 
         """
         if not self.can_transition:
             raise core.environment.Exception("Environment need to be reset.")
 
+        if self.native is not None:
+            self.__sync_native()
+            self.can_transition = False
+            observation, action_set, reward, done, info = self.native.step(action)
+            self.can_transition = not done
+            return observation, action_set, reward, done, info
+
         try:
+            solver_start = self.model.solver_time(wall=True)
+            start = time.perf_counter()
             done, action_set = self.dynamics.step_dynamics(self.model, action)
+            done, action_set = self.__enforce_memory_budget(done, action_set)
+            dynamics_time = time.perf_counter() - start
+            solver_time = self.model.solver_time(wall=True) - solver_start
+            self.can_transition = not done
+            start = time.perf_counter()
             reward = self.reward_function.obtain_reward(self.model, done)
+            reward_time = time.perf_counter() - start
+            start = time.perf_counter()
             observation = self.observation_function.obtain_observation(self.model)
-            return observation, action_set, reward, done, {}
+            observation_time = time.perf_counter() - start
+            stats = self.model.stats()
+            info = {
+                "done_reason": core.environment.done_reason(self.model, done, self.memory_exceeded),
+                "memory": self.model.memory_stats(),
+                "observation_memory": _observation_memory(observation),
+                "timings": {
+                    "dynamics": dynamics_time,
+                    "solver": solver_time,
+                    "handoff": max(dynamics_time - solver_time, 0.0),
+                    "observation": observation_time,
+                    "reward": reward_time,
+                },
+                "n_nodes": stats["n_nodes"] - self.last_stats["n_nodes"],
+                "n_lp_iterations": stats["n_lp_iterations"] - self.last_stats["n_lp_iterations"],
+            }
+            self.last_stats = stats
+            return observation, action_set, reward, done, info
         except Exception as e:
             self.can_transition = False
             raise e
 
+    def __enforce_memory_budget(self, done, action_set):
+        """Stop the solving process if the model exceeds the memory budget."""
+        if done or not self.memory_budget:
+            return done, action_set
+        if not core.environment.exceeds_memory_budget(self.model, self.memory_budget):
+            return done, action_set
+        self.model.solve_iter_stop()
+        self.memory_exceeded = True
+        return True, None
+
     def seed(self, value: int) -> None:
         """Set the random seed of the environment.
 
@@ -171,12 +288,23 @@ class EnvironmentComposer:
         `random <https://docs.python.org/library/random.html>`_ module.
         """
         self.random_engine.seed(value)
+        if self.native is not None:
+            self.native.seed(value)
 
 
 class Branching(EnvironmentComposer):
     __Dynamics__ = core.environment.BranchingDynamics
     __DefaultObservationFunction__ = ecole.observation.NodeBipartite
+    __NativeEnvironments__ = {
+        ecole.observation.NodeBipartite: core.environment.BranchingNodeBipartite,
+        ecole.observation.StrongBranchingScores: core.environment.BranchingStrongBranchingScores,
+        ecole.observation.Nothing: core.environment.BranchingNothing,
+    }
 
 
 class Configuring(EnvironmentComposer):
     __Dynamics__ = core.environment.ConfiguringDynamics
+    __NativeEnvironments__ = {
+        ecole.observation.NodeBipartite: core.environment.ConfiguringNodeBipartite,
+        ecole.observation.Nothing: core.environment.ConfiguringNothing,
+    }
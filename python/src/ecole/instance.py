@@ -0,0 +1,43 @@
+"""Sources of problem instances, and their prefetching in the background."""
+
+import os
+
+from ecole.core.instance import *
+
+
+def prefetch(instances, n_ahead=2, memory_budget=0, cycle=False, profile="full"):
+    """Read or generate instances ahead of time in a background thread.
+
+    Parameters
+    ----------
+    instances:
+        An :py:class:`InstanceSource`, a glob pattern, a list of file paths, or any iterable of
+        :py:class:`ecole.scip.Model` or file paths (such as a generator).
+    n_ahead:
+        Maximum number of instances kept ready.
+    memory_budget:
+        Maximum solver memory of the ready instances in bytes, or zero for no budget.
+    cycle:
+        Whether to cycle back to the first file at the end of a pattern or list.
+    profile:
+        Name of the plugin profile of models read from files.
+
+    Returns
+    -------
+    prefetcher:
+        An :py:class:`InstancePrefetcher`, iterating over ready to use models, that can be given
+        to :py:meth:`ecole.environment.EnvironmentComposer.reset`.
+
+    """
+    if isinstance(instances, InstanceSource):
+        source = instances
+    elif isinstance(instances, (str, os.PathLike)):
+        source = FileSource.from_glob(os.fspath(instances), cycle=cycle, profile=profile)
+    elif isinstance(instances, (list, tuple)) and all(
+        isinstance(i, (str, os.PathLike)) for i in instances
+    ):
+        filenames = [os.fspath(i) for i in instances]
+        source = FileSource(filenames, cycle=cycle, profile=profile)
+    else:
+        source = GeneratorSource(instances, profile=profile)
+    return InstancePrefetcher(source, n_ahead=n_ahead, memory_budget=memory_budget)
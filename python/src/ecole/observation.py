@@ -1,37 +1,70 @@
 from ecole.core.observation import *
 
 
+__NativeFunctions__ = (NodeBipartite, StrongBranchingScores, Nothing)
+
+
+def _make_native(observation_functions):
+    """Compose the functions in C++ if they are all native, otherwise return None.
+
+    Subclasses are excluded as they may override methods that C++ would not call.
+    """
+    if all(type(obs_func) in __NativeFunctions__ for obs_func in observation_functions.values()):
+        return NativeDictFunction(observation_functions)
+    return None
+
+
 class TupleFunction:
-    """Pack observation functions together and return observations as tuples."""
+    """Pack observation functions together and return observations as tuples.
+
+    When all functions are native, observations are extracted in C++ in a single call.
+    """
 
     def __init__(self, *observation_functions):
         """Store positional observation functions."""
         self.observation_functions = observation_functions
+        self.native = _make_native({str(i): f for i, f in enumerate(observation_functions)})
 
     def reset(self, model):
         """Call reset on all observation functions."""
+        if self.native is not None:
+            self.native.reset(model)
+            return
         for obs_func in self.observation_functions:
             obs_func.reset(model)
 
     def obtain_observation(self, model):
         """Return observation from all functions as a tuple."""
+        if self.native is not None:
+            observations = self.native.obtain_observation(model)
+            return tuple(observations[str(i)] for i in range(len(self.observation_functions)))
         return tuple(obs_func.obtain_observation(model) for obs_func in self.observation_functions)
 
 
 class DictFunction:
-    """Pack observation functions together and return observations as dicts."""
+    """Pack observation functions together and return observations as dicts.
+
+    When all functions are native, observations are extracted in C++ in a single call.
+    """
 
     def __init__(self, **observation_functions):
         """Store named observation functions."""
         self.observation_functions = observation_functions
+        self.native = _make_native(observation_functions)
 
     def reset(self, model):
         """Call reset on all observation functions."""
+        if self.native is not None:
+            self.native.reset(model)
+            return
         for obs_func in self.observation_functions.values():
             obs_func.reset(model)
 
     def obtain_observation(self, model):
         """Return observation from all functions as a dict."""
+        if self.native is not None:
+            observations = self.native.obtain_observation(model)
+            return {name: observations[name] for name in self.observation_functions}
         return {
             name: obs_func.obtain_observation(model)
             for name, obs_func in self.observation_functions.items()
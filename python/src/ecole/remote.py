@@ -0,0 +1,432 @@
+"""Environments served over a socket, to run solvers and policies on different hosts.
+
+Every message is a binary frame made of a fixed header and a pickled payload.
+From pickle protocol 5, the buffers of observations are sent raw, out of band, after the pickle.
+
+    +-----------+------------+--------+---------+-----------+-----------------+--------+---------+
+    | length u4 | request u4 | env u2 | code u1 | n_bufs u2 | buf lengths u8* | pickle | buffers |
+    +-----------+------------+--------+---------+-----------+-----------------+--------+---------+
+
+Requests are tagged with an identifier, so that a client can pipeline many requests, for many
+environments hosted on the same connection, before reading the responses.
+The server runs every environment in its own thread, so that environments of a connection
+transition concurrently (native environments release the GIL).
+
+.. warning::
+    Frames are unpickled with a restricted unpickler, which only creates the Ecole types sent by
+    the protocol (models, observations, information, and exceptions), NumPy arrays and scalars,
+    and a few builtin types and exceptions.
+    Pickle was not designed against malicious data, and anyone able to connect can still make the
+    server read problem instances and run the solver.
+    Only serve on Unix domain sockets, or on the loopback interface (the default for TCP), unless
+    the network is trusted.
+"""
+
+import builtins
+import concurrent.futures
+import io
+import ipaddress
+import pickle
+import queue
+import socket
+import struct
+import threading
+
+__all__ = ("EnvironmentServer", "RemoteConnection", "RemoteEnvironment")
+
+_HEADER = struct.Struct("<IIHBH")
+_BUFFER_LENGTH = struct.Struct("<Q")
+_PROTOCOL = pickle.HIGHEST_PROTOCOL
+
+# Request codes
+_CREATE, _SEED, _RESET, _STEP, _CLOSE = range(5)
+# Response codes
+_OK, _ERROR = range(2)
+
+
+# Globals that frames may refer to, besides builtins
+_ALLOWED_GLOBALS = {
+    ("ecole.core.environment", "DoneReason"),
+    ("ecole.core.environment", "Exception"),
+    ("ecole.core.observation", "NodeBipartiteObs"),
+    ("ecole.core.observation", "coo_matrix"),
+    ("ecole.core.scip", "Exception"),
+    ("ecole.core.scip", "MemoryStats"),
+    ("ecole.core.scip", "Model"),
+    ("copyreg", "__newobj__"),
+    ("copyreg", "_reconstructor"),
+    ("pathlib", "PosixPath"),
+    ("pathlib", "PurePosixPath"),
+    ("numpy", "ndarray"),
+    ("numpy", "dtype"),
+    ("numpy.core.multiarray", "_reconstruct"),
+    ("numpy.core.multiarray", "scalar"),
+    ("numpy.core.numeric", "_frombuffer"),
+    ("numpy._core.multiarray", "_reconstruct"),
+    ("numpy._core.multiarray", "scalar"),
+    ("numpy._core.numeric", "_frombuffer"),
+}
+_ALLOWED_BUILTINS = {"bytearray", "complex", "frozenset", "range", "set", "slice"}
+
+
+class _RestrictedUnpickler(pickle.Unpickler):
+    """Unpickler only creating the Ecole value types, NumPy arrays, and harmless builtins."""
+
+    def find_class(self, module, name):
+        if module == "builtins":
+            obj = getattr(builtins, name, None)
+            is_exception = isinstance(obj, type) and issubclass(obj, BaseException)
+            if name in _ALLOWED_BUILTINS or is_exception:
+                return obj
+        elif (module, name) in _ALLOWED_GLOBALS:
+            return super().find_class(module, name)
+        raise pickle.UnpicklingError(f"Global '{module}.{name}' is not allowed in a frame.")
+
+
+def _loads(data, buffers):
+    """Deserialize a payload with the restricted unpickler."""
+    if _PROTOCOL >= 5:
+        return _RestrictedUnpickler(io.BytesIO(data), buffers=buffers).load()
+    return _RestrictedUnpickler(io.BytesIO(data)).load()
+
+
+def _family(address):
+    """Unix domain socket for paths, TCP for ``(host, port)`` pairs."""
+    return socket.AF_INET if isinstance(address, tuple) else socket.AF_UNIX
+
+
+def _is_loopback(host):
+    """Whether a host name or address is the loopback interface."""
+    if host == "localhost":
+        return True
+    try:
+        return ipaddress.ip_address(host).is_loopback
+    except ValueError:
+        return False
+
+
+def _encode(request_id, env_id, code, payload):
+    """Serialize a frame, as a list of buffers to send."""
+    buffers = []
+    if _PROTOCOL >= 5:
+        data = pickle.dumps(payload, protocol=_PROTOCOL, buffer_callback=buffers.append)
+        buffers = [b.raw() for b in buffers]
+    else:
+        data = pickle.dumps(payload, protocol=_PROTOCOL)
+    lengths = b"".join(_BUFFER_LENGTH.pack(b.nbytes) for b in buffers)
+    length = _HEADER.size - 4 + len(lengths) + len(data) + sum(b.nbytes for b in buffers)
+    header = _HEADER.pack(length, request_id, env_id, code, len(buffers))
+    return [header, lengths, data, *buffers]
+
+
+def _receive_exactly(sock, n_bytes):
+    """Read a given number of bytes, or None if the connection is closed first."""
+    data = bytearray(n_bytes)
+    view = memoryview(data)
+    while view:
+        n_read = sock.recv_into(view)
+        if n_read == 0:
+            return None
+        view = view[n_read:]
+    return data
+
+
+def _receive(sock):
+    """Read and deserialize a frame, or None if the connection was closed."""
+    header = _receive_exactly(sock, _HEADER.size)
+    if header is None:
+        return None
+    length, request_id, env_id, code, n_buffers = _HEADER.unpack(header)
+    body = _receive_exactly(sock, length - (_HEADER.size - 4))
+    if body is None:
+        return None
+    view = memoryview(body)
+    lengths = [
+        _BUFFER_LENGTH.unpack_from(view, i * _BUFFER_LENGTH.size)[0] for i in range(n_buffers)
+    ]
+    view = view[n_buffers * _BUFFER_LENGTH.size :]
+    data_length = len(view) - sum(lengths)
+    data, view = view[:data_length], view[data_length:]
+    buffers = []
+    for buffer_length in lengths:
+        buffers.append(view[:buffer_length])
+        view = view[buffer_length:]
+    return request_id, env_id, code, _loads(data, buffers)
+
+
+def _picklable_exception(exception):
+    """The exception if it can be sent back, or a RuntimeError describing it."""
+    try:
+        pickle.dumps(exception)
+        return exception
+    except Exception:
+        return RuntimeError(repr(exception))
+
+
+class _Sender:
+    """Thread safe writing of frames on a socket."""
+
+    def __init__(self, sock):
+        self.sock = sock
+        self.lock = threading.Lock()
+
+    def send(self, request_id, env_id, code, payload):
+        frame = _encode(request_id, env_id, code, payload)
+        with self.lock:
+            for part in frame:
+                self.sock.sendall(part)
+
+
+class _ServedEnvironment:
+    """An environment of a connection, processing its requests in order in its own thread."""
+
+    def __init__(self, environment, env_id, sender):
+        self.environment = environment
+        self.env_id = env_id
+        self.sender = sender
+        self.requests = queue.Queue()
+        self.thread = threading.Thread(target=self.__run, daemon=True)
+        self.thread.start()
+
+    def __run(self):
+        while True:
+            request = self.requests.get()
+            if request is None:
+                return
+            request_id, code, args = request
+            try:
+                result = self.__process(code, args)
+                self.sender.send(request_id, self.env_id, _OK, result)
+            except Exception as e:
+                self.sender.send(request_id, self.env_id, _ERROR, _picklable_exception(e))
+
+    def __process(self, code, args):
+        if code == _SEED:
+            return self.environment.seed(*args)
+        if code == _RESET:
+            return self.environment.reset(*args)
+        if code == _STEP:
+            return self.environment.step(*args)
+        raise ValueError(f"Unknown request code {code}.")
+
+    def close(self):
+        self.requests.put(None)
+        self.thread.join()
+
+
+class EnvironmentServer:
+    """Serve environments to remote clients.
+
+    Every connection can create many environments, all made by the same factory.
+
+    .. warning::
+        The server has no authentication: anyone able to connect can run environments, and send
+        problem instances and pickled data to it.
+        By default, TCP servers only listen on the loopback interface.
+    """
+
+    def __init__(self, make_environment, address, allow_remote_hosts=False):
+        """Listen on a Unix domain socket path, or a TCP ``(host, port)`` address.
+
+        Parameters
+        ----------
+        make_environment:
+            Callable creating a new environment (for instance an environment class).
+        address:
+            Where to listen.
+        allow_remote_hosts:
+            Whether to accept a TCP address other than the loopback interface, reachable from
+            other hosts.
+            Only do so on a trusted network.
+
+        """
+        if _family(address) == socket.AF_INET and not allow_remote_hosts:
+            if not _is_loopback(address[0]):
+                raise ValueError(
+                    f"Listening on {address[0]!r} exposes the server to other hosts, "
+                    "pass allow_remote_hosts=True to do it anyway."
+                )
+        self.make_environment = make_environment
+        self.sock = socket.socket(_family(address), socket.SOCK_STREAM)
+        if _family(address) == socket.AF_INET:
+            self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.sock.bind(address)
+        self.sock.listen()
+        self.address = self.sock.getsockname()
+        self.thread = None
+
+    def serve_forever(self):
+        """Accept connections until the server is closed."""
+        while True:
+            try:
+                sock, _ = self.sock.accept()
+            except OSError:
+                return
+            threading.Thread(target=self.__serve_connection, args=(sock,), daemon=True).start()
+
+    def start(self):
+        """Accept connections in a background thread."""
+        self.thread = threading.Thread(target=self.serve_forever, daemon=True)
+        self.thread.start()
+        return self
+
+    def close(self):
+        """Stop accepting connections."""
+        try:
+            self.sock.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+        self.sock.close()
+        if self.thread is not None:
+            self.thread.join()
+
+    def __enter__(self):
+        return self.start()
+
+    def __exit__(self, *args):
+        self.close()
+
+    def __serve_connection(self, sock):
+        if sock.family != socket.AF_UNIX:
+            sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        sender = _Sender(sock)
+        environments = {}
+        next_env_id = 0
+        try:
+            while True:
+                frame = _receive(sock)
+                if frame is None:
+                    return
+                request_id, env_id, code, args = frame
+                if code == _CREATE:
+                    try:
+                        environment = self.make_environment()
+                    except Exception as e:
+                        sender.send(request_id, env_id, _ERROR, _picklable_exception(e))
+                        continue
+                    env_id, next_env_id = next_env_id, next_env_id + 1
+                    environments[env_id] = _ServedEnvironment(environment, env_id, sender)
+                    sender.send(request_id, env_id, _OK, env_id)
+                elif env_id not in environments:
+                    error = KeyError(f"No environment {env_id} on this connection.")
+                    sender.send(request_id, env_id, _ERROR, error)
+                elif code == _CLOSE:
+                    environments.pop(env_id).close()
+                    sender.send(request_id, env_id, _OK, None)
+                else:
+                    environments[env_id].requests.put((request_id, code, args))
+        finally:
+            for environment in environments.values():
+                environment.close()
+            sock.close()
+
+
+class RemoteConnection:
+    """Connection to an :py:class:`EnvironmentServer`, hosting many remote environments.
+
+    Requests are pipelined: every method ending in ``_async`` sends its request and returns a
+    :py:class:`concurrent.futures.Future` without waiting for the response.
+    """
+
+    def __init__(self, address):
+        self.sock = socket.socket(_family(address), socket.SOCK_STREAM)
+        self.sock.connect(address)
+        if _family(address) == socket.AF_INET:
+            self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.sender = _Sender(self.sock)
+        self.futures = {}
+        self.futures_lock = threading.Lock()
+        self.next_request_id = 0
+        self.receiver = threading.Thread(target=self.__receive_responses, daemon=True)
+        self.receiver.start()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def request_async(self, env_id, code, args):
+        """Send a request and return the future of its response."""
+        future = concurrent.futures.Future()
+        with self.futures_lock:
+            request_id = self.next_request_id
+            self.next_request_id = (self.next_request_id + 1) % 2 ** 32
+            self.futures[request_id] = future
+        self.sender.send(request_id, env_id, code, args)
+        return future
+
+    def environment(self):
+        """Create a new environment on the server."""
+        env_id = self.request_async(0, _CREATE, ()).result()
+        return RemoteEnvironment(self, env_id)
+
+    def close(self):
+        """Close the connection, failing pending requests."""
+        try:
+            self.sock.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+        self.receiver.join()
+        self.sock.close()
+
+    def __receive_responses(self):
+        try:
+            while True:
+                frame = _receive(self.sock)
+                if frame is None:
+                    break
+                request_id, _, code, payload = frame
+                with self.futures_lock:
+                    future = self.futures.pop(request_id)
+                if code == _OK:
+                    future.set_result(payload)
+                else:
+                    future.set_exception(payload)
+        except OSError:
+            pass
+        with self.futures_lock:
+            futures, self.futures = self.futures, {}
+        for future in futures.values():
+            future.set_exception(ConnectionError("Connection to the environment server closed."))
+
+
+class RemoteEnvironment:
+    """An environment running on an :py:class:`EnvironmentServer`.
+
+    Same interface as :py:class:`ecole.environment.EnvironmentComposer`.
+    Instances given to :py:meth:`reset` are either file paths on the server, or
+    :py:class:`ecole.scip.Model` sent over the connection.
+    """
+
+    def __init__(self, connection, env_id):
+        self.connection = connection
+        self.env_id = env_id
+
+    def __request(self, code, *args):
+        return self.connection.request_async(self.env_id, code, args)
+
+    def seed_async(self, value):
+        return self.__request(_SEED, value)
+
+    def reset_async(self, instance):
+        return self.__request(_RESET, instance)
+
+    def step_async(self, action):
+        return self.__request(_STEP, action)
+
+    def seed(self, value):
+        """Set the random seed of the remote environment."""
+        self.seed_async(value).result()
+
+    def reset(self, instance):
+        """Reset the remote environment, see :py:meth:`EnvironmentComposer.reset`."""
+        return self.reset_async(instance).result()
+
+    def step(self, action):
+        """Transition the remote environment, see :py:meth:`EnvironmentComposer.step`."""
+        return self.step_async(action).result()
+
+    def close(self):
+        """Free the environment on the server."""
+        self.__request(_CLOSE).result()
@@ -0,0 +1,341 @@
+"""Vectorized environments running in worker processes.
+
+Workers write observations in a shared memory ring buffer, so that the learner reads them
+without copy nor serialization.
+Only the small remainder of transitions (rewards, done flags, information) goes through pipes.
+"""
+
+import ctypes
+import math
+import multiprocessing
+import pickle
+
+import numpy as np
+
+
+class SlotLayout:
+    """Fixed layout of a shared memory slot holding a NodeBipartiteObs and an action set.
+
+    A slot starts with a header of 64 bits integers, followed by the buffers at their maximum
+    size.
+    All fields are 8 bytes wide, hence naturally aligned.
+    """
+
+    __Header__ = ("sequence", "n_columns", "n_rows", "nnz", "has_observation", "n_actions")
+
+    def __init__(self, max_columns, max_rows, max_nnz, n_column_features, n_row_features):
+        """Set the maximum sizes of the observation buffers."""
+        self.max_columns = max_columns
+        self.max_rows = max_rows
+        self.max_nnz = max_nnz
+        self.n_column_features = n_column_features
+        self.n_row_features = n_row_features
+        self.fields = (
+            ("column_features", np.float64, max_columns * n_column_features),
+            ("row_features", np.float64, max_rows * n_row_features),
+            ("edge_values", np.float64, max_nnz),
+            ("edge_indices", np.uint64, 2 * max_nnz),
+            ("action_set", np.uint64, max_columns),
+        )
+        self.header_nbytes = 8 * len(self.__Header__)
+        self.nbytes = self.header_nbytes + sum(8 * size for _, _, size in self.fields)
+
+    @classmethod
+    def from_observation(cls, observation, slack=2.0):
+        """Layout fitting observations up to `slack` times larger than the one given."""
+        n_columns, n_column_features = observation.column_features.shape
+        n_rows, n_row_features = observation.row_features.shape
+        return cls(
+            max_columns=math.ceil(slack * n_columns),
+            max_rows=math.ceil(slack * n_rows),
+            max_nnz=math.ceil(slack * observation.edge_features.nnz),
+            n_column_features=n_column_features,
+            n_row_features=n_row_features,
+        )
+
+
+class SharedCooMatrix:
+    """Sparse matrix in the coordinate format, viewing shared memory."""
+
+    def __init__(self, values, indices, shape):
+        self.values = values
+        self.indices = indices
+        self.shape = shape
+
+    @property
+    def nnz(self):
+        return self.values.size
+
+    @property
+    def nbytes(self):
+        return self.values.nbytes + self.indices.nbytes
+
+
+class SharedNodeBipartiteObs:
+    """A NodeBipartiteObs viewing a slot of shared memory.
+
+    The views remain valid until the worker recycles the slot, that is after as many new
+    transitions of the same environment as there are slots per environment.
+    """
+
+    def __init__(self, slot, sequence, column_features, row_features, edge_features):
+        self.slot = slot
+        self.sequence = sequence
+        self.column_features = column_features
+        self.row_features = row_features
+        self.edge_features = edge_features
+
+    @property
+    def valid(self):
+        """Whether the slot still holds this observation."""
+        return self.slot.sequence == self.sequence
+
+    @property
+    def nbytes(self):
+        return self.column_features.nbytes + self.row_features.nbytes + self.edge_features.nbytes
+
+
+class _Slot:
+    """Views on a slot of the shared memory buffer."""
+
+    def __init__(self, array, offset, layout):
+        self.layout = layout
+        n_header = len(layout.__Header__)
+        self.header = np.frombuffer(array, dtype=np.int64, count=n_header, offset=offset)
+        self.buffers = {}
+        offset += layout.header_nbytes
+        for name, dtype, size in layout.fields:
+            self.buffers[name] = np.frombuffer(array, dtype=dtype, count=size, offset=offset)
+            offset += 8 * size
+
+    @property
+    def sequence(self):
+        return int(self.header[0])
+
+    def __write_buffer(self, name, data):
+        data = np.asarray(data).ravel()
+        buffer = self.buffers[name]
+        if data.size > buffer.size:
+            raise ValueError(f"The {name} of size {data.size} does not fit in {buffer.size}.")
+        buffer[: data.size] = data
+
+    def write(self, sequence, observation, action_set):
+        """Copy the observation and action set in the slot, then publish its sequence number."""
+        # A negative sequence marks the slot as being written
+        self.header[0] = -1
+        if observation is not None:
+            self.__write_buffer("column_features", observation.column_features)
+            self.__write_buffer("row_features", observation.row_features)
+            self.__write_buffer("edge_values", observation.edge_features.values)
+            self.__write_buffer("edge_indices", observation.edge_features.indices)
+            n_columns, n_rows = len(observation.column_features), len(observation.row_features)
+            self.header[1:4] = (n_columns, n_rows, observation.edge_features.nnz)
+        self.header[4] = observation is not None
+        if action_set is not None:
+            self.__write_buffer("action_set", action_set)
+        self.header[5] = -1 if action_set is None else len(action_set)
+        self.header[0] = sequence
+
+    def __view(self, name, *shape):
+        return self.buffers[name][: np.prod(shape, dtype=int)].reshape(shape)
+
+    def read(self, sequence):
+        """View the observation and action set published with the given sequence number."""
+        if self.sequence != sequence:
+            raise RuntimeError("Shared memory slot was overwritten before being read.")
+        _, n_columns, n_rows, nnz, has_observation, n_actions = (int(h) for h in self.header)
+        observation = None
+        if has_observation:
+            n_column_features = self.layout.n_column_features
+            n_row_features = self.layout.n_row_features
+            observation = SharedNodeBipartiteObs(
+                slot=self,
+                sequence=sequence,
+                column_features=self.__view("column_features", n_columns, n_column_features),
+                row_features=self.__view("row_features", n_rows, n_row_features),
+                edge_features=SharedCooMatrix(
+                    values=self.__view("edge_values", nnz),
+                    indices=self.__view("edge_indices", 2, nnz),
+                    shape=(n_rows, n_columns),
+                ),
+            )
+        action_set = None if n_actions < 0 else self.buffers["action_set"][:n_actions]
+        return observation, action_set
+
+
+def _picklable_exception(exception):
+    """The exception if it can be sent to the learner, or a RuntimeError describing it."""
+    try:
+        pickle.dumps(exception)
+        return exception
+    except Exception:
+        return RuntimeError(repr(exception))
+
+
+def _worker(make_environment, connection, buffer, layout, offsets):
+    """Run an environment, publishing observations in the slots at the given offsets."""
+    array = np.frombuffer(buffer, dtype=np.uint8)
+    slots = [_Slot(array, offset, layout) for offset in offsets]
+    sequence = 0
+    environment = make_environment()
+
+    def publish(observation, action_set):
+        nonlocal sequence
+        sequence += 1
+        slots[sequence % len(slots)].write(sequence, observation, action_set)
+        return sequence
+
+    while True:
+        command, args = connection.recv()
+        try:
+            if command == "close":
+                connection.send(("ok", None))
+                break
+            elif command == "seed":
+                environment.seed(*args)
+                result = None
+            elif command == "reset":
+                observation, action_set, reward_offset, done = environment.reset(*args)
+                result = publish(observation, action_set), reward_offset, done
+            elif command == "step":
+                observation, action_set, reward, done, info = environment.step(*args)
+                result = publish(observation, action_set), reward, done, info
+            else:
+                raise ValueError(f"Unknown command {command}.")
+            connection.send(("ok", result))
+        except Exception as e:
+            connection.send(("error", _picklable_exception(e)))
+    connection.close()
+
+
+class VectorEnvironment:
+    """Multiple environments, each running in its own worker process.
+
+    Every worker owns `n_slots` slots of a shared memory ring buffer with a fixed
+    :py:class:`SlotLayout`, in which it writes its observations (:py:class:`NodeBipartiteObs` or
+    ``None``) and action sets.
+    Observations are returned as :py:class:`SharedNodeBipartiteObs` views on the shared memory,
+    valid until the worker recycles the slot, after `n_slots` more transitions.
+    Copy them to keep them longer.
+
+    Commands are sent to all workers before waiting for any result, so that environments
+    transition in parallel.
+    """
+
+    def __init__(self, make_environment, n_environments, layout, n_slots=2, context=None):
+        """Start the workers.
+
+        Parameters
+        ----------
+        make_environment:
+            Callable creating an environment in the worker process.
+            It must be picklable when the multiprocessing context does not fork.
+        n_environments:
+            Number of worker processes.
+        layout:
+            The :py:class:`SlotLayout` of observations.
+        n_slots:
+            Number of slots per environment in the ring buffer.
+        context:
+            Name of the multiprocessing start method, by default the platform one.
+
+        """
+        if n_slots < 1:
+            raise ValueError("At least one slot per environment is needed.")
+        mp_context = multiprocessing.get_context(context)
+        self.layout = layout
+        self.n_slots = n_slots
+        self.buffer = mp_context.RawArray(ctypes.c_uint8, n_environments * n_slots * layout.nbytes)
+        array = np.frombuffer(self.buffer, dtype=np.uint8)
+        self.slots = []
+        self.connections = []
+        self.processes = []
+        for i in range(n_environments):
+            offsets = [(i * n_slots + j) * layout.nbytes for j in range(n_slots)]
+            self.slots.append([_Slot(array, offset, layout) for offset in offsets])
+            connection, worker_connection = mp_context.Pipe()
+            process = mp_context.Process(
+                target=_worker,
+                args=(make_environment, worker_connection, self.buffer, layout, offsets),
+                daemon=True,
+            )
+            process.start()
+            worker_connection.close()
+            self.connections.append(connection)
+            self.processes.append(process)
+
+    def __len__(self):
+        return len(self.connections)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def __request(self, commands):
+        """Send commands to all workers (``None`` to skip one), then gather their results."""
+        for connection, command in zip(self.connections, commands):
+            if command is not None:
+                connection.send(command)
+        results, error = [], None
+        for connection, command in zip(self.connections, commands):
+            if command is None:
+                results.append(None)
+                continue
+            status, result = connection.recv()
+            if status == "error" and error is None:
+                error = result
+            results.append(result)
+        if error is not None:
+            raise error
+        return results
+
+    def __read(self, index, sequence):
+        return self.slots[index][sequence % self.n_slots].read(sequence)
+
+    def seed(self, seeds):
+        """Seed every environment with its own value."""
+        self.__request([("seed", (s,)) for s in seeds])
+
+    def reset(self, instances):
+        """Reset every environment on its instance (a file name or a Model).
+
+        Returns the list of ``(observation, action_set, reward_offset, done)`` of all
+        environments.
+        """
+        if len(instances) != len(self):
+            raise ValueError(f"Expected {len(self)} instances, got {len(instances)}.")
+        results = self.__request([("reset", (instance,)) for instance in instances])
+        return [
+            (*self.__read(i, sequence), reward_offset, done)
+            for i, (sequence, reward_offset, done) in enumerate(results)
+        ]
+
+    def step(self, actions):
+        """Transition every environment with its action, or skip it if the action is ``None``.
+
+        Returns the list of ``(observation, action_set, reward, done, info)`` of all environments,
+        with ``None`` for those skipped.
+        """
+        if len(actions) != len(self):
+            raise ValueError(f"Expected {len(self)} actions, got {len(actions)}.")
+        commands = [None if action is None else ("step", (action,)) for action in actions]
+        results = self.__request(commands)
+        return [
+            None if result is None else (*self.__read(i, result[0]), *result[1:])
+            for i, result in enumerate(results)
+        ]
+
+    def close(self):
+        """Stop the workers."""
+        if not self.processes:
+            return
+        try:
+            self.__request([("close", ()) for _ in self.connections])
+        finally:
+            for process in self.processes:
+                process.join()
+            for connection in self.connections:
+                connection.close()
+            self.processes, self.connections = [], []
@@ -3,6 +3,9 @@ import itertools
 import pytest
 
 import ecole.environment as environment
+import ecole.observation
+import ecole.reward
+import ecole.scip
 
 
 def product_parametrize(**params):
@@ -42,3 +45,87 @@ def test_branching_exception(model):
     with pytest.raises(environment.Exception):
         env = environment.Branching()
         env.step(-1)
+
+
+def test_branching_info(model):
+    env = environment.Branching()
+    obs, action_set, reward_offset, done = env.reset(model)
+    obs, action_set, reward, done, info = env.step(action_set[0])
+    assert info["memory"].used > 0
+    assert info["memory"].peak >= info["memory"].total
+    assert info["n_nodes"] >= 1
+    timings = info["timings"]
+    assert timings["dynamics"] >= timings["handoff"] >= 0
+    assert timings["solver"] > 0
+    if not done:
+        assert info["done_reason"] == environment.DoneReason.NotDone
+        assert info["observation_memory"] == obs.nbytes > 0
+
+
+def test_branching_memory_budget(model):
+    env = environment.Branching()
+    obs, action_set, reward_offset, done = env.reset(model)
+    env.memory_budget = 1
+    obs, action_set, reward, done, info = env.step(action_set[0])
+    assert done
+    assert action_set is None
+    assert info["done_reason"] == environment.DoneReason.MemoryLimit
+
+
+def test_branching_root_warm_start(model):
+    cache = ecole.scip.RootBasisCache()
+    env = environment.Branching(root_basis_cache=cache)
+    for _ in range(2):
+        env.reset(model.copy_orig())
+    assert cache.size == 1
+    assert cache.n_warm_starts == 1
+
+
+def test_branching_before_reset(model):
+    env = environment.Branching(reward_function=-ecole.reward.PrimalDualIntegral())
+    obs, action_set, reward_offset, done = env.reset(model)
+    while not done:
+        obs, action_set, reward, done, info = env.step(action_set[0])
+        assert reward >= 0
+
+
+def test_branching_native(model):
+    env = environment.Branching()
+    assert env.native is not None
+    obs, action_set, reward_offset, done = env.reset(model)
+    assert env.model is not model
+    obs, action_set, reward, done, info = env.step(action_set[0])
+    assert info["done_reason"] is not None
+
+
+def test_branching_python_observation(model):
+    env = environment.Branching(observation_function=(ecole.observation.Nothing(),))
+    assert env.native is None
+    obs, action_set, reward_offset, done = env.reset(model)
+    assert obs == (None,)
+    assert env.model is not model
+
+
+@pytest.mark.parametrize("observation_function", ("default", (ecole.observation.Nothing(),)))
+def test_branching_reuse_model(problem_file, observation_function):
+    env = environment.Branching(observation_function=observation_function, reuse_model=True)
+    env.reset(str(problem_file))
+    model = env.model
+    for _ in range(2):
+        obs, action_set, reward_offset, done = env.reset(str(problem_file))
+        assert env.model is model
+        while not done:
+            obs, action_set, reward, done, info = env.step(action_set[0])
+
+
+@pytest.mark.parametrize("observation_function", ("default", (ecole.observation.Nothing(),)))
+def test_branching_presolve_cache(problem_file, observation_function):
+    model = ecole.scip.Model.from_file(str(problem_file))
+    cache = ecole.scip.PresolveCache()
+    env = environment.Branching(observation_function=observation_function, presolve_cache=cache)
+    for _ in range(2):
+        obs, action_set, reward_offset, done = env.reset(model.copy_orig())
+        assert env.presolved_problem is not None
+        while not done:
+            obs, action_set, reward, done, info = env.step(action_set[0])
+    assert (cache.size, cache.n_hits, cache.n_misses) == (1, 1, 1)
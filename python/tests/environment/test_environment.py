@@ -55,4 +55,12 @@ def test_scip_params(model):
     """Reset sets parameters on the model."""
     env = MockEnvironment(scip_params={"concurrent/paramsetprefix": "testname"})
     env.reset(model)
-    assert model.get_param("concurrent/paramsetprefix") == "testname"
+    assert env.model.get_param("concurrent/paramsetprefix") == "testname"
+
+
+def test_reset_copies_model(model):
+    """Like native environments, Python environments solve a copy of the model."""
+    env = MockEnvironment()
+    env.reset(model)
+    assert env.model is not model
+    assert env.model.fingerprint() == model.fingerprint()
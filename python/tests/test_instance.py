@@ -0,0 +1,54 @@
+import pytest
+
+import ecole.environment
+import ecole.instance
+import ecole.observation
+import ecole.scip
+
+
+def test_prefetch_file_list(problem_file):
+    with ecole.instance.prefetch([problem_file] * 3, n_ahead=2) as prefetcher:
+        models = list(prefetcher)
+        stats = prefetcher.stats()
+    assert len(models) == 3
+    assert all(isinstance(m, ecole.scip.Model) for m in models)
+    assert stats.n_instances == 3
+    assert stats.n_ready == 0
+    assert stats.stall_time >= 0
+
+
+def test_prefetch_glob(problem_file):
+    with ecole.instance.prefetch(problem_file.parent / "*.mps") as prefetcher:
+        assert len(list(prefetcher)) == 2
+
+
+def test_prefetch_generator(model):
+    def generate():
+        for _ in range(3):
+            yield model
+
+    with ecole.instance.prefetch(generate()) as prefetcher:
+        models = list(prefetcher)
+    assert len(models) == 3
+    assert all(m.fingerprint() == model.fingerprint() for m in models)
+
+
+def test_prefetch_generator_error():
+    def generate():
+        raise ValueError("Cannot generate")
+        yield
+
+    with ecole.instance.prefetch(generate()) as prefetcher:
+        with pytest.raises(ValueError, match="Cannot generate"):
+            next(prefetcher)
+
+
+@pytest.mark.parametrize("observation_function", ("default", (ecole.observation.Nothing(),)))
+def test_reset_on_prefetcher(problem_file, observation_function):
+    env = ecole.environment.Branching(observation_function=observation_function)
+    with ecole.instance.prefetch([problem_file] * 2) as prefetcher:
+        for _ in range(2):
+            obs, action_set, reward_offset, done = env.reset(prefetcher)
+            assert not done
+        with pytest.raises(ecole.environment.Exception):
+            env.reset(prefetcher)
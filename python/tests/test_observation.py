@@ -1,3 +1,4 @@
+import pickle
 import unittest.mock as mock
 
 import pytest
@@ -48,6 +49,25 @@ def test_DictFunction(model):
     assert obs == {"name1": "something", "name2": "else"}
 
 
+def test_native_composites(solving_model):
+    """Compose native observation functions in C++."""
+    tuple_obs_func = O.TupleFunction(O.NodeBipartite(), O.Nothing())
+    dict_obs_func = O.DictFunction(node=O.NodeBipartite(), nothing=O.Nothing())
+    assert tuple_obs_func.native is not None
+    assert dict_obs_func.native is not None
+
+    tuple_obs_func.reset(solving_model)
+    node_obs, nothing_obs = tuple_obs_func.obtain_observation(solving_model)
+    assert isinstance(node_obs, O.NodeBipartiteObs)
+    assert nothing_obs is None
+
+    dict_obs_func.reset(solving_model)
+    obs = dict_obs_func.obtain_observation(solving_model)
+    assert list(obs.keys()) == ["node", "nothing"]
+    assert isinstance(obs["node"], O.NodeBipartiteObs)
+    assert obs["nothing"] is None
+
+
 def test_NodeBipartite(solving_model):
     obs = O.NodeBipartite().obtain_observation(solving_model)
     assert isinstance(obs, O.NodeBipartiteObs)
@@ -74,3 +94,55 @@ def test_StrongBranchingScores(solving_model):
     assert isinstance(obs, np.ndarray)
     assert obs.size > 0
     assert len(obs.shape) == 1
+
+
+requires_dlpack = pytest.mark.skipif(
+    not hasattr(np, "from_dlpack"), reason="NumPy does not support DLPack."
+)
+
+
+@requires_dlpack
+def test_NodeBipartite_dlpack(solving_model):
+    obs = O.NodeBipartite().obtain_observation(solving_model)
+    column_features = obs.column_features.copy()
+    edge_nnz = obs.edge_features.nnz
+    view = obs.column_features
+
+    tensors = obs.to_dlpack()
+    # The buffers are shared, the observation and its NumPy arrays stay valid
+    assert np.all(obs.column_features == column_features)
+    del obs
+    assert np.all(view == column_features)
+    assert tensors["column_features"].__dlpack_device__() == (1, 0)
+    assert tensors["column_features"].shape == column_features.shape
+    assert np.all(np.from_dlpack(tensors["column_features"]) == column_features)
+    assert tensors["column_features"].consumed
+    assert np.from_dlpack(tensors["edge_indices"]).shape == (2, edge_nnz)
+
+
+@requires_dlpack
+def test_StrongBranchingScores_dlpack(solving_model):
+    scores = O.StrongBranchingScores().obtain_observation_dlpack(solving_model)
+    array = np.from_dlpack(scores)
+    assert len(array.shape) == 1
+    assert array.size > 0
+    with pytest.raises(RuntimeError):
+        scores.__dlpack__()
+
+
+@pytest.mark.parametrize("protocol", (4, 5))
+def test_NodeBipartiteObs_pickle(solving_model, protocol):
+    obs = O.NodeBipartite().obtain_observation(solving_model)
+    if protocol >= 5:
+        buffers = []
+        data = pickle.dumps(obs, protocol=protocol, buffer_callback=buffers.append)
+        assert len(buffers) == 4
+        unpickled = pickle.loads(data, buffers=buffers)
+    else:
+        unpickled = pickle.loads(pickle.dumps(obs, protocol=protocol))
+
+    assert np.all(unpickled.column_features == obs.column_features)
+    assert np.all(unpickled.row_features == obs.row_features)
+    assert np.all(unpickled.edge_features.values == obs.edge_features.values)
+    assert np.all(unpickled.edge_features.indices == obs.edge_features.indices)
+    assert unpickled.edge_features.shape == obs.edge_features.shape
@@ -0,0 +1,81 @@
+import pickle
+
+import numpy as np
+import pytest
+
+import ecole.environment
+import ecole.observation
+import ecole.remote
+import ecole.scip
+
+
+def make_environment():
+    return ecole.environment.Branching(observation_function=ecole.observation.NodeBipartite())
+
+
+@pytest.fixture
+def server(tmp_path):
+    with ecole.remote.EnvironmentServer(make_environment, str(tmp_path / "ecole.sock")) as server:
+        yield server
+
+
+def test_reset_step(server, problem_file):
+    local_env = make_environment()
+    local_env.seed(0)
+    local_obs, local_action_set, _, _ = local_env.reset(str(problem_file))
+
+    with ecole.remote.RemoteConnection(server.address) as connection:
+        env = connection.environment()
+        env.seed(0)
+        obs, action_set, _, done = env.reset(str(problem_file))
+        assert not done
+        assert isinstance(obs, ecole.observation.NodeBipartiteObs)
+        assert np.all(obs.column_features == local_obs.column_features)
+        assert np.all(action_set == local_action_set)
+
+        _, _, _, _, info = env.step(action_set[0])
+        assert "done_reason" in info
+
+
+def test_pipelining(server, model):
+    with ecole.remote.RemoteConnection(server.address) as connection:
+        envs = [connection.environment() for _ in range(2)]
+        futures = [env.reset_async(model) for env in envs]
+        for future in futures:
+            obs, _, _, _ = future.result()
+            assert isinstance(obs, ecole.observation.NodeBipartiteObs)
+
+
+def test_remote_exception(server):
+    with ecole.remote.RemoteConnection(server.address) as connection:
+        env = connection.environment()
+        with pytest.raises(ecole.environment.Exception):
+            env.step(0)
+
+
+def test_tcp_loopback_only(problem_file):
+    with pytest.raises(ValueError):
+        ecole.remote.EnvironmentServer(make_environment, ("0.0.0.0", 0))
+    with ecole.remote.EnvironmentServer(make_environment, ("127.0.0.1", 0)) as server:
+        with ecole.remote.RemoteConnection(server.address) as connection:
+            _, _, _, done = connection.environment().reset(str(problem_file))
+            assert not done
+
+
+def test_restricted_unpickler(model):
+    allowed = (
+        np.arange(3),
+        np.int64(1),
+        model,
+        model.memory_stats(),
+        ecole.environment.DoneReason.Finished,
+        ecole.environment.Exception("message"),
+        ValueError("message"),
+        {"key": [1.0, None]},
+    )
+    for obj in allowed:
+        ecole.remote._loads(pickle.dumps(obj), [])
+    rejected = (print, pickle.loads, ecole.environment.set_memory_limit, ecole.scip.ModelPool)
+    for obj in rejected:
+        with pytest.raises(pickle.UnpicklingError):
+            ecole.remote._loads(pickle.dumps(obj), [])
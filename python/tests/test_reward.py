@@ -1,5 +1,7 @@
 import math
 
+import pytest
+
 import ecole.reward as R
 
 
@@ -48,3 +50,90 @@ def test_LpIterations(model):
     reward_func = R.LpIterations()
     reward_func.reset(model)
     assert reward_func.obtain_reward(model) <= 0
+
+
+def test_native_arithmetic(model):
+    func = -R.LpIterations() + 0.1 * R.IsDone()
+    func.reset(model)
+    assert isinstance(func, R.RewardFunction)
+    assert func.obtain_reward(model, done=True) == 0.1
+
+
+def test_python_operand(model):
+    class Two:
+        def reset(self, model):
+            pass
+
+        def obtain_reward(self, model, done=False):
+            return 2
+
+    func = R.Constant(1) + Two()
+    func.reset(model)
+    assert func.obtain_reward(model) == 3
+
+
+def test_python_semantics(model):
+    assert (R.Constant(-7) // 2).obtain_reward(model) == -7 // 2
+    assert (R.Constant(-7) % 2).obtain_reward(model) == -7 % 2
+    assert round(R.Constant(2.5)).obtain_reward(model) == round(2.5)
+
+
+@pytest.mark.parametrize(
+    "func",
+    (
+        R.Constant(1) / 0,
+        R.Constant(1) // 0,
+        R.Constant(1) % 0,
+        R.Constant(0) ** -1,
+        1 / R.Constant(0),
+        1 // R.Constant(0),
+        1 % R.Constant(0),
+        0 ** R.Constant(-1),
+    ),
+)
+def test_zero_division(model, func):
+    with pytest.raises(ZeroDivisionError):
+        func.obtain_reward(model)
+
+
+def test_SolvingTime(model):
+    for wall in (False, True):
+        reward_func = R.SolvingTime(wall=wall)
+        solved = model.copy_orig()
+        reward_func.reset(solved)
+        assert reward_func.obtain_reward(solved) == 0
+        solved.solve()
+        assert reward_func.obtain_reward(solved) < 0
+
+
+def test_PrimalDualIntegral(model):
+    reward_func = R.PrimalDualIntegral()
+    reward_func.before_reset(model)
+    reward_func.reset(model)
+    model.solve()
+    assert -model.stats()["solving_time"] <= reward_func.obtain_reward(model) <= 0
+
+
+def test_NNodes(model):
+    reward_func = R.NNodes()
+    reward_func.reset(model)
+    model.solve()
+    assert reward_func.obtain_reward(model) == -model.stats()["n_nodes"]
+    assert reward_func.obtain_reward(model) == 0
+
+
+def test_TreeSize(model):
+    reward_func = R.TreeSize()
+    reward_func.reset(model)
+    assert reward_func.obtain_reward(model) == 0
+    model.solve()
+    assert reward_func.obtain_reward(model) == -model.stats()["n_nodes"]
+
+
+def test_Progress(model):
+    progress = R.Progress()
+    progress.reset(model)
+    model.solve()
+    rewards = progress.obtain_rewards(model)
+    assert rewards["n_nodes"] == -model.stats()["n_nodes"]
+    assert rewards["lp_iterations"] == -model.stats()["n_lp_iterations"]
@@ -1,7 +1,9 @@
 import importlib.util
+import pickle
 
 import pytest
 
+import ecole.reward
 import ecole.scip
 
 
@@ -15,6 +17,46 @@ def test_equality(model):
     assert model != 33
 
 
+@pytest.mark.parametrize("profile", ("full", "minimal-branching"))
+def test_plugin_profile(problem_file, profile):
+    model = ecole.scip.Model.from_file(str(problem_file), profile=profile)
+    model.disable_cuts()
+    model.disable_presolve()
+    model.solve()
+    assert ecole.scip.Model(profile) != model
+
+
+def test_unknown_plugin_profile():
+    with pytest.raises(ecole.scip.Exception):
+        ecole.scip.Model("not-a-profile")
+
+
+@pytest.mark.parametrize("as_buffer", (bytes, bytearray, memoryview))
+def test_from_buffer(problem_file, as_buffer):
+    expected = ecole.scip.Model.from_file(str(problem_file))
+    model = ecole.scip.Model.from_buffer(as_buffer(problem_file.read_bytes()), "mps")
+    assert model.fingerprint() == expected.fingerprint()
+
+
+def test_write_orig_prob_buffer(model):
+    content = model.write_orig_prob_buffer("lp")
+    assert isinstance(content, bytes)
+    assert len(content) > 0
+    ecole.scip.Model.from_buffer(content, "lp")
+
+
+def test_snapshot(model, tmp_path):
+    content = model.write_snapshot()
+    assert isinstance(content, bytes)
+    loaded = ecole.scip.Model.from_snapshot(content)
+    assert loaded.write_orig_prob_buffer("lp") == model.write_orig_prob_buffer("lp")
+
+    filepath = tmp_path / "model.snap"
+    model.write_snapshot_file(str(filepath))
+    loaded_file = ecole.scip.Model.from_snapshot_file(str(filepath))
+    assert loaded_file.write_orig_prob_buffer("lp") == model.write_orig_prob_buffer("lp")
+
+
 def test_copy_orig(model):
     model_copy = model.copy_orig()
     assert model is not model_copy
@@ -120,3 +162,103 @@ def test_set_params(model):
 
     for name, _ in names_types:
         assert model.get_param(name) == params[name]
+
+
+def test_model_pool(problem_file):
+    pool = ecole.scip.ModelPool.global_pool()
+    assert pool.capacity == 0
+    pool.capacity = 1
+    try:
+        model = ecole.scip.Model.from_file(str(problem_file))
+        del model
+        assert pool.size == 1
+        recycled = ecole.scip.Model.from_file(str(problem_file))
+        assert pool.size == 0
+        del recycled
+    finally:
+        pool.capacity = 0
+    assert pool.size == 0
+
+
+def test_solver_time(model):
+    model.solve()
+    assert model.solver_time() == model.solver_time(wall=False)
+    assert model.solver_time(wall=True) > 0
+    # Same default clock as the SolvingTime reward
+    assert not ecole.reward.SolvingTime().wall
+
+
+def test_log_capture(model):
+    assert model.log_tail() == ""
+    model.enable_log_capture(capacity=64)
+    model.solve()
+    assert 0 < len(model.log_tail()) <= 64
+    model.disable_log_capture()
+    assert model.log_tail() == ""
+
+
+def test_pickle(model):
+    model.set_param("limits/nodes", 12)
+    unpickled = pickle.loads(pickle.dumps(model))
+    assert unpickled != model
+    assert unpickled.write_orig_prob_buffer("lp") == model.write_orig_prob_buffer("lp")
+    assert unpickled.get_param("limits/nodes") == 12
+    assert unpickled.get_non_default_params() == model.get_non_default_params()
+
+
+def test_pickle_empty_model():
+    pickle.loads(pickle.dumps(ecole.scip.Model()))
+
+
+def test_pickle_profile(problem_file):
+    model = ecole.scip.Model.from_file(str(problem_file), profile="minimal-branching")
+    assert pickle.loads(pickle.dumps(model)).profile == "minimal-branching"
+    assert pickle.loads(pickle.dumps(ecole.scip.Model())).profile == "full"
+
+
+def test_fingerprint(model):
+    assert model.fingerprint() == model.copy_orig().fingerprint()
+    assert model.fingerprint() != ecole.scip.Model().fingerprint()
+
+
+def test_root_warm_start(model):
+    cache = ecole.scip.RootBasisCache()
+    lp_iterations_saved = []
+    for _ in range(2):
+        warm = model.copy_orig()
+        warm.enable_root_warm_start(cache)
+        warm.solve()
+        lp_iterations_saved.append(warm.root_lp_iterations_saved())
+    assert cache.size == 1
+    assert cache.n_warm_starts == 1
+    assert lp_iterations_saved[0] == 0
+    assert lp_iterations_saved[1] > 0
+    assert cache.lp_iterations_saved == lp_iterations_saved[1]
+
+
+def test_presolve_cache(problem_file):
+    model = ecole.scip.Model.from_file(str(problem_file))
+    cache = ecole.scip.PresolveCache()
+    problem = cache.get_or_presolve(model)
+    copy = model.copy_orig()
+    copy.set_param("randomization/randomseedshift", 7)
+    assert cache.get_or_presolve(copy) is problem
+    assert (cache.size, cache.n_hits, cache.n_misses) == (1, 1, 1)
+    # Presolving removed variables, the original ones depend on fewer presolved ones
+    presolved_indices = {i for var in problem.original_variables for i, _ in var.terms}
+    assert len(presolved_indices) < len(problem.original_variables)
+    presolved = problem.copy_model()
+    presolved.disable_presolve()
+    presolved.solve()
+
+
+def test_stats(model):
+    stats = model.stats()
+    assert stats["n_nodes"] == 0
+    assert stats["depth"] == -1
+    model.solve()
+    stats = model.stats()
+    assert stats["n_nodes"] >= 1
+    assert stats["n_lp_iterations"] > 0
+    assert stats["primal_bound"] == pytest.approx(stats["dual_bound"])
+    assert stats["memory"]["peak"] > 0
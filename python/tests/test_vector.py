@@ -0,0 +1,46 @@
+import numpy as np
+import pytest
+
+import ecole.environment
+import ecole.observation
+import ecole.vector
+
+
+def make_environment():
+    env = ecole.environment.Branching(observation_function=ecole.observation.NodeBipartite())
+    env.seed(0)
+    return env
+
+
+@pytest.fixture
+def layout(problem_file):
+    obs, _, _, _ = make_environment().reset(str(problem_file))
+    return ecole.vector.SlotLayout.from_observation(obs)
+
+
+def test_reset_step(problem_file, layout):
+    local_obs, local_action_set, _, _ = make_environment().reset(str(problem_file))
+
+    with ecole.vector.VectorEnvironment(make_environment, 2, layout) as vec_env:
+        transitions = vec_env.reset([str(problem_file)] * 2)
+        for obs, action_set, _, done in transitions:
+            assert not done
+            assert isinstance(obs, ecole.vector.SharedNodeBipartiteObs)
+            assert np.all(obs.column_features == local_obs.column_features)
+            assert np.all(obs.edge_features.indices == local_obs.edge_features.indices)
+            assert np.all(action_set == local_action_set)
+
+        first_obs = transitions[0][0]
+        actions = [transitions[0][1][0], None]
+        transitions = vec_env.step(actions)
+        assert transitions[1] is None
+        obs, action_set, reward, done, info = transitions[0]
+        assert first_obs.valid == (vec_env.n_slots > 1)
+        assert "done_reason" in info
+
+
+def test_observation_too_large(problem_file, layout):
+    small_layout = ecole.vector.SlotLayout(1, 1, 1, layout.n_column_features, layout.n_row_features)
+    with ecole.vector.VectorEnvironment(make_environment, 1, small_layout) as vec_env:
+        with pytest.raises(ValueError):
+            vec_env.reset([str(problem_file)])